@@ -0,0 +1,80 @@
+/*
+    This file is part of Perun2.
+    Perun2 is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    Perun2 is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with Perun2. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include "datatype/primitives.hpp"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace perun2
+{
+
+
+p_constexpr p_size ARENA_CHUNK_SIZE = 64 * 1024;
+// bigger requests get a chunk of their own
+p_constexpr p_size ARENA_MAX_SMALL_SIZE = ARENA_CHUNK_SIZE / 4;
+// every node is preceded by a header that says where its memory comes from
+p_constexpr p_size ARENA_HEADER_SIZE = alignof(std::max_align_t);
+
+
+// monotonic memory for parse-time nodes (generators and commands) of one process
+// nodes are never released one by one
+// all of them are released together when the arena is reset or destroyed
+struct Arena
+{
+public:
+   Arena() = default;
+   Arena(Arena const&) = delete;
+   Arena& operator= (Arena const&) = delete;
+
+   void* allocate(const p_size size);
+
+   // release all the memory, but keep one chunk for the next nodes
+   // every node allocated here has to be destroyed before
+   void reset();
+
+private:
+   std::vector<std::unique_ptr<unsigned char[]>> chunks;
+   p_size used = 0;
+   p_size capacity = 0;
+};
+
+
+// while this object exists, nodes created on the current thread come from the arena
+// otherwise, they come from the heap as usual
+struct ArenaScope
+{
+public:
+   ArenaScope() = delete;
+   ArenaScope(Arena& arena);
+   ~ArenaScope() noexcept;
+
+private:
+   Arena* const previous;
+};
+
+
+// base of every node type
+struct ArenaNode
+{
+public:
+   static void* operator new(const std::size_t size);
+   static void operator delete(void* ptr) noexcept;
+};
+
+
+}
@@ -27,6 +27,8 @@ p_constexpr p_flags FLAG_SILENT =               1 << 1;
 p_constexpr p_flags FLAG_GUI =                  1 << 2;
 p_constexpr p_flags FLAG_STATIC_ANALYSIS =      1 << 3;
 p_constexpr p_flags FLAG_MAX_PERFORMANCE =      1 << 4;
+p_constexpr p_flags FLAG_SIZE_INDEX =           1 << 5;
+p_constexpr p_flags FLAG_PARALLEL =             1 << 6;
 
 p_constexpr p_char CHAR_FLAG_GUI =              CHAR_g;
 p_constexpr p_char CHAR_FLAG_NOOMIT =           CHAR_n;
@@ -36,6 +38,8 @@ p_constexpr p_char CHAR_FLAG_HERE =             CHAR_h;
 p_constexpr p_char CHAR_FLAG_CODE =             CHAR_c;
 p_constexpr p_char CHAR_FLAG_STATIC_ANALYSIS =  CHAR_m;
 p_constexpr p_char CHAR_FLAG_MAX_PERFORMANCE =  CHAR_o;
+p_constexpr p_char CHAR_FLAG_SIZE_INDEX =       CHAR_i;
+p_constexpr p_char CHAR_FLAG_PARALLEL =         CHAR_p;
 
 p_constexpr p_char CHAR_FLAG_GUI_UPPER =        CHAR_G;
 p_constexpr p_char CHAR_FLAG_NOOMIT_UPPER =     CHAR_N;
@@ -45,6 +49,8 @@ p_constexpr p_char CHAR_FLAG_HERE_UPPER =       CHAR_H;
 p_constexpr p_char CHAR_FLAG_CODE_UPPER =       CHAR_C;
 p_constexpr p_char CHAR_FLAG_STATIC_ANALYSIS_UPPER =  CHAR_M;
 p_constexpr p_char CHAR_FLAG_MAX_PERFORMANCE_UPPER =  CHAR_O;
+p_constexpr p_char CHAR_FLAG_SIZE_INDEX_UPPER =  CHAR_I;
+p_constexpr p_char CHAR_FLAG_PARALLEL_UPPER =   CHAR_P;
 
 
 enum ArgsParseState 
@@ -76,6 +82,7 @@ public:
    const p_str& getCodeRef() const;
    ArgsParseState getParseState() const;
    p_bool hasFlag(const p_flags flag) const;
+   void setLocation(const p_str& loc);
 
 private:
    p_str code;
@@ -47,6 +47,12 @@ p_constexpr p_aunit ATTR_SIZE =           1 << 19;
 p_constexpr p_aunit ATTR_SIZE_FILE_ONLY=  1 << 20;
 p_constexpr p_aunit ATTR_IMAGE_OR_VIDEO = 1 << 21;
 
+// extension and name do not imply ATTR_EXISTS
+// they only depend on whether the element is a file or a directory
+// and if there is no extension in the path, the answer is the same for both
+// so they may be evaluated without any query to the file system
+p_constexpr p_aunit ATTR_TYPE_DEPENDENT = ATTR_EXISTS | ATTR_EXTENSION | ATTR_NAME;
+
 // certain expression or syntax structure may require multiple file attributes:
 // for example - creation time, modification time, size and extension
 // they also may repeat
@@ -12,37 +12,106 @@
     along with Perun2. If not, see <http://www.gnu.org/licenses/>.
 */
 
+
 #pragma once
 
 #include "datatype/datatype.hpp"
+#include "arguments.hpp"
+#include "os/os-common.hpp"
 #include <unordered_map>
+#include <mutex>
 
 namespace perun2
 {
 
 
 p_constexpr size_t CACHE_SIZE = 100;
+p_constexpr size_t CACHE_NO_UNIT = CACHE_SIZE;
+p_constexpr size_t CACHE_MAX_PREFETCHED = CACHE_SIZE;
 
 
+// results of file system queries about one path
+// every group of values is filled separately, when it is needed for the first time
 struct CacheUnit
 {
+   p_str path;
+
+   p_bool hasData = false;
+   p_bool exists = false;
+   p_adata data;
+
+   p_bool hasSize = false;
+   p_num size;
 
+   p_bool hasEmpty = false;
+   p_bool empty = false;
 
+   p_bool hasMedia = false;
+   MediaAttributes media;
+
+   // neighbours on the list of recently used units
+   size_t previous = CACHE_NO_UNIT;
+   size_t next = CACHE_NO_UNIT;
 };
 
 
+// attributes queried ahead of time by another thread
+struct CachePrefetched
+{
+   p_bool exists;
+   p_adata data;
+};
+
+
+// bounded cache of file attributes, keyed by normalized path
+// it is used only in the maximum performance mode
+// commands that alter the file system invalidate what they have touched
 struct Cache
 {
 public:
-   Cache();
-
+   Cache() = delete;
+   Cache(const p_flags flags);
+
+   // return nullptr if the cache is disabled
+   // otherwise, return the unit of this path, which becomes the most recently used one
+   // if there is no such unit, the least recently used one is cleared and reused
+   // the pointer is valid only until the next call
+   CacheUnit* get(const p_str& path);
+
+   // forget the path, everything inside it and all of its ancestors
+   // as their sizes and emptiness could have changed too
+   void invalidate(const p_str& path);
+
+   // forget everything
+   // external programs can alter anything
+   void clear();
+
+   // store attributes queried by a prefetching thread
+   // they are moved into a unit when its path is asked for the first time
+   // the thread takes the generation before its query
+   // so the result is dropped if anything has been invalidated in the meantime
+   // these two are the only methods that can be called by another thread
+   p_size getGeneration();
+   void prefetch(const p_str& path, const p_size generation, const p_bool exists, const p_adata& data);
 
 private:
+   void takePrefetched(CacheUnit& unit);
+   void unlink(const size_t index);
+   void pushFront(const size_t index);
+   void pushBack(const size_t index);
+   void release(const size_t index);
 
+   const p_bool enabled;
    std::unordered_map<std::wstring, size_t> elements;
-
    std::vector<CacheUnit> realData;
 
+   // the most and the least recently used units
+   size_t first = CACHE_NO_UNIT;
+   size_t last = CACHE_NO_UNIT;
+
+   std::unordered_map<p_str, CachePrefetched> prefetched;
+   p_size generation = 0;
+   std::mutex prefetchMutex;
 };
 
 }
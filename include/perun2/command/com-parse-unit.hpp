@@ -69,6 +69,7 @@ public:
    void addClosed(p_comptr* pntr);
    void deleteClosedUnits();
    void deleteLast();
+   void reset();
    void lockLast();
    p_bool isExpandable() const;
    void addElse(p_comptr& com, const p_int line);
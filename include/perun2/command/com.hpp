@@ -14,13 +14,14 @@
 
 #pragma once
 
+#include "../arena.hpp"
 #include <memory>
 
 
 namespace perun2
 {
 
-struct Command
+struct Command : ArenaNode
 {
 public:
    virtual void run() = 0;
@@ -29,6 +29,15 @@ namespace perun2
 
       template <typename T>
       void insertConstant(const p_str& name)
+      {
+         Variable<T>* v = this->globalVars.insertVar<T>(name, VarType::vt_Special);
+         v->isConstant_ = true;
+         v->isStable_ = true;
+      }
+
+      // the value is constant during one run, but can change before the next one
+      template <typename T>
+      void insertRunConstant(const p_str& name)
       {
          Variable<T>* v = this->globalVars.insertVar<T>(name, VarType::vt_Special);
          v->isConstant_ = true;
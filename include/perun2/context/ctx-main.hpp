@@ -61,6 +61,7 @@ namespace perun2
 
       // working location context
       void addLocationContext(LocationContext* ctx);
+      void setRootLocation(const p_str& location);
       void retreatLocationContext();
 
       // for aggregates
@@ -79,6 +80,10 @@ namespace perun2
       void closeAttributeScope();
       void closeDeepAttributeScope();
 
+      // drop the contexts left by the last parsing
+      // it could have been interrupted by a syntax error before retreating them
+      void resetParsing();
+
       p_varptr<p_bool> success;
       std::unordered_map<p_str, gen::DefinitionGenerator> osGenerators;
 
@@ -17,6 +17,7 @@
 #include "../datatype/datatype.hpp"
 #include "../var.hpp"
 #include <unordered_map>
+#include <deque>
 
 
 namespace perun2
@@ -25,31 +26,85 @@ namespace perun2
    template <typename T>
    using p_varptr = std::unique_ptr<Variable<T>>;
 
+
+   // variables of one type are kept in slots of a frame
+   // slots are allocated in chunks, so they never move after being created
+   // and variables declared one after another lie next to each other in memory
+   // names are needed only during parsing to resolve the slots
    template <typename T>
-   using p_varptrs = std::unordered_map<p_str, p_varptr<T>>;
+   struct VarsFrame
+   {
+   public:
+      Variable<T>* get(const p_str& name) const
+      {
+         auto v = this->names.find(name);
+         return v == this->names.end()
+            ? nullptr
+            : v->second;
+      }
+
+      // if the name is already taken, the existing variable is returned
+      Variable<T>* insert(const p_str& name, const VarType type)
+      {
+         auto v = this->names.find(name);
+         if (v != this->names.end()) {
+            return v->second;
+         }
+
+         Variable<T>* slot = &this->slots.emplace_back(type);
+         this->names.insert(std::make_pair(name, slot));
+         return slot;
+      }
+
+      // special variables have their own implementation of getValue()
+      // so they do not fit into the slots
+      Variable<T>* insert(const p_str& name, p_varptr<T>&& special)
+      {
+         Variable<T>* ptr = special.get();
+         this->specials.push_back(std::move(special));
+         this->names.insert(std::make_pair(name, ptr));
+         return ptr;
+      }
+
+      // variables assigned by the last run get their default values back
+      // constant ones keep the value they received during parsing
+      void reset()
+      {
+         for (Variable<T>& v : this->slots) {
+            if (!v.isConstant_) {
+               v.value = T();
+            }
+         }
+      }
+
+   private:
+      std::unordered_map<p_str, Variable<T>*> names;
+      std::deque<Variable<T>> slots;
+      std::vector<p_varptr<T>> specials;
+   };
 
 
    struct VarsContext
    {
    public:
 
-      void takeVarsPtr(p_varptrs<p_bool>*& result) { result = &this->bools; };
-      void takeVarsPtr(p_varptrs<p_tim>*& result) { result = &this->times; };
-      void takeVarsPtr(p_varptrs<p_per>*& result) { result = &this->periods; };
-      void takeVarsPtr(p_varptrs<p_str>*& result) { result = &this->strings; };
-      void takeVarsPtr(p_varptrs<p_num>*& result) { result = &this->numbers; };
-      void takeVarsPtr(p_varptrs<p_tlist>*& result) { result = &this->timeLists; };
-      void takeVarsPtr(p_varptrs<p_nlist>*& result) { result = &this->numLists; };
-      void takeVarsPtr(p_varptrs<p_list>*& result) { result = &this->lists; };
+      void takeFrame(VarsFrame<p_bool>*& result) { result = &this->bools; };
+      void takeFrame(VarsFrame<p_tim>*& result) { result = &this->times; };
+      void takeFrame(VarsFrame<p_per>*& result) { result = &this->periods; };
+      void takeFrame(VarsFrame<p_str>*& result) { result = &this->strings; };
+      void takeFrame(VarsFrame<p_num>*& result) { result = &this->numbers; };
+      void takeFrame(VarsFrame<p_tlist>*& result) { result = &this->timeLists; };
+      void takeFrame(VarsFrame<p_nlist>*& result) { result = &this->numLists; };
+      void takeFrame(VarsFrame<p_list>*& result) { result = &this->lists; };
 
       template <typename T>
       p_bool takeVar(const p_str& var, Variable<T>*& result)
       {
-         p_varptrs<T>* vars;
-         this->takeVarsPtr(vars);
-         auto v = vars->find(var);
-         if (v != vars->end()) {
-            result = v->second.get();
+         VarsFrame<T>* frame;
+         this->takeFrame(frame);
+         Variable<T>* v = frame->get(var);
+         if (v != nullptr) {
+            result = v;
             return true;
          }
 
@@ -59,20 +114,31 @@ namespace perun2
       template <typename T>
       Variable<T>* insertVar(const p_str& var, const VarType type)
       {
-         p_varptrs<T>* vars;
-         this->takeVarsPtr(vars);
-         auto a = vars->insert(std::make_pair(var, std::make_unique<Variable<T>>(type)));
-         return a.first->second.get();
+         VarsFrame<T>* frame;
+         this->takeFrame(frame);
+         return frame->insert(var, type);
+      }
+
+      void reset()
+      {
+         this->bools.reset();
+         this->times.reset();
+         this->periods.reset();
+         this->strings.reset();
+         this->numbers.reset();
+         this->timeLists.reset();
+         this->numLists.reset();
+         this->lists.reset();
       }
 
-      p_varptrs<p_bool> bools;
-      p_varptrs<p_tim> times;
-      p_varptrs<p_per> periods;
-      p_varptrs<p_str> strings;
-      p_varptrs<p_num> numbers;
-      p_varptrs<p_tlist> timeLists;
-      p_varptrs<p_nlist> numLists;
-      p_varptrs<p_list> lists;
+      VarsFrame<p_bool> bools;
+      VarsFrame<p_tim> times;
+      VarsFrame<p_per> periods;
+      VarsFrame<p_str> strings;
+      VarsFrame<p_num> numbers;
+      VarsFrame<p_tlist> timeLists;
+      VarsFrame<p_nlist> numLists;
+      VarsFrame<p_list> lists;
    };
 
 
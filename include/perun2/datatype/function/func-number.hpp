@@ -16,6 +16,7 @@
 
 #include "func-generic.hpp"
 #include "../../perun2.hpp"
+#include "../text/resemblance.hpp"
 
 
 namespace perun2::func
@@ -241,7 +242,7 @@ public:
    p_num getValue() override;
 
 private:
-   p_str pattern;
+   gen::ResemblancePattern pattern;
 };
 
 
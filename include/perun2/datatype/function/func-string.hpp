@@ -65,6 +65,7 @@ struct F_Lower : Func_1<p_str>, Generator<p_str>
 public:
    F_Lower(p_genptr<p_str>& a1) : Func_1(a1) { };
    p_str getValue() override;
+   void writeValue(p_str& result) override;
 };
 
 
@@ -73,6 +74,7 @@ struct F_Trim : Func_1<p_str>, Generator<p_str>
 public:
    F_Trim(p_genptr<p_str>& a1) : Func_1(a1) { };
    p_str getValue() override;
+   void writeValue(p_str& result) override;
 };
 
 
@@ -81,6 +83,7 @@ struct F_Upper : Func_1<p_str>, Generator<p_str>
 public:
    F_Upper(p_genptr<p_str>& a1) : Func_1(a1) { };
    p_str getValue() override;
+   void writeValue(p_str& result) override;
 };
 
 
@@ -185,6 +188,11 @@ struct F_Replace : Func_3<p_str, p_str, p_str>, Generator<p_str>
 public:
    F_Replace(p_genptr<p_str>& a1, p_genptr<p_str>& a2, p_genptr<p_str>& a3) : Func_3(a1, a2, a3) { };
    p_str getValue() override;
+   void writeValue(p_str& result) override;
+
+private:
+   p_str buffer1;
+   p_str buffer2;
 };
 
 
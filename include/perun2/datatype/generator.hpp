@@ -15,6 +15,7 @@
 #pragma once
 
 #include "primitives.hpp"
+#include "../arena.hpp"
 #include <memory>
 
 
@@ -25,7 +26,7 @@ namespace perun2
 // that generates a new instance of a certain data type
 // when its method getValue() is called
 template <typename T>
-struct Generator
+struct Generator : ArenaNode
 {
 public:
 
@@ -38,10 +39,57 @@ public:
       // and use this knowledge in optimizations
       return false;
    };
+
+   virtual p_bool isFoldable() const
+   {
+      // the value is the same on every run of every parsed script
+      // so the whole subtree can be replaced by one constant after parsing
+      // unlike isConstant(), this is never true for user variables
+      return false;
+   };
+
+   virtual const T* getAddress() const
+   {
+      // generators that hold their value in memory expose it here
+      // so nodes built over them can read it in place
+      // without a virtual call and a copy of the value
+      return nullptr;
+   };
+
+   virtual void writeValue(T& result)
+   {
+      // writes the value into a buffer owned by the caller
+      // so its memory is reused between evaluations
+      // generators that build strings override this and append to the buffer directly
+      const T* address = this->getAddress();
+
+      if (address == nullptr) {
+         result = this->getValue();
+      }
+      else {
+         result = *address;
+      }
+   };
 };
 
 
 template <typename T>
 using p_genptr = std::unique_ptr<Generator<T>>;
 
+
+// read the value of a generator without copying it if it is kept in memory
+// otherwise, the buffer is filled and returned
+template <typename T>
+const T& readValue(Generator<T>& generator, T& buffer)
+{
+   const T* address = generator.getAddress();
+
+   if (address == nullptr) {
+      generator.writeValue(buffer);
+      return buffer;
+   }
+
+   return *address;
+}
+
 }
@@ -17,6 +17,7 @@
 #include "../datatype.hpp"
 #include "../comparison.hpp"
 #include "../../perun2.hpp"
+#include <functional>
 
 
 namespace perun2::gen
@@ -30,9 +31,30 @@ public:
    Comparison<T> (p_genptr<T>& val1, p_genptr<T>& val2)
       : value1(std::move(val1)), value2(std::move(val2)) { };
 
+   p_bool isFoldable() const override
+   {
+      return this->value1->isFoldable() && this->value2->isFoldable();
+   };
+
 protected:
+   // operands kept in memory are read in place
+   // other ones are written into buffers that live as long as this node
+   const T& getValue1()
+   {
+      return readValue(*this->value1, this->buffer1);
+   }
+
+   const T& getValue2()
+   {
+      return readValue(*this->value2, this->buffer2);
+   }
+
    p_genptr<T> value1;
    p_genptr<T> value2;
+
+private:
+   T buffer1;
+   T buffer2;
 };
 
 
@@ -45,7 +67,7 @@ public:
 
    p_bool getValue() override
    {
-      return this->value1->getValue() == this->value2->getValue();
+      return this->getValue1() == this->getValue2();
    }
 };
 
@@ -59,7 +81,7 @@ public:
 
    p_bool getValue() override
    {
-      return this->value1->getValue() != this->value2->getValue();
+      return this->getValue1() != this->getValue2();
    }
 };
 
@@ -73,7 +95,7 @@ public:
 
    p_bool getValue() override
    {
-      return this->value1->getValue() < this->value2->getValue();
+      return this->getValue1() < this->getValue2();
    }
 };
 
@@ -87,7 +109,7 @@ public:
 
    p_bool getValue() override
    {
-      return this->value1->getValue() <= this->value2->getValue();
+      return this->getValue1() <= this->getValue2();
    }
 };
 
@@ -101,7 +123,7 @@ public:
 
    p_bool getValue() override
    {
-      return this->value1->getValue() > this->value2->getValue();
+      return this->getValue1() > this->getValue2();
    }
 };
 
@@ -115,11 +137,36 @@ public:
 
    p_bool getValue() override
    {
-      return this->value1->getValue() >= this->value2->getValue();
+      return this->getValue1() >= this->getValue2();
    }
 };
 
 
+// both operands hold their values in memory (variables and constants)
+// so they are compared where they are
+// instead of calling getValue() on both sides and copying the results
+// this is what most of the 'where' filters reduce to
+template <typename T, typename Compare>
+struct InPlaceComparison : Comparison<T>
+{
+public:
+   InPlaceComparison(p_genptr<T>& val1, p_genptr<T>& val2)
+      : Comparison<T>(val1, val2),
+        address1(this->value1->getAddress()),
+        address2(this->value2->getAddress()) { };
+
+   p_bool getValue() override
+   {
+      return this->compare(*this->address1, *this->address2);
+   }
+
+private:
+   const T* const address1;
+   const T* const address2;
+   Compare compare;
+};
+
+
 // here collections
 
 template <typename T>
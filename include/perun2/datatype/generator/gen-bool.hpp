@@ -78,6 +78,11 @@ public:
       return false;
    };
 
+   p_bool isFoldable() const override
+   {
+      return this->value->isFoldable() && this->list->isFoldable();
+   };
+
 private:
    p_genptr<T> value;
    p_genptr<std::vector<T>> list;
@@ -102,6 +107,11 @@ public:
       return std::binary_search(list.begin(), list.end(), value->getValue());
    };
 
+   p_bool isFoldable() const override
+   {
+      return this->value->isFoldable();
+   };
+
 private:
    p_genptr<T> value;
    std::vector<T> list;
@@ -116,6 +126,7 @@ struct InConstTimeList : Generator<p_bool>
 public:
    InConstTimeList(p_genptr<p_tim>& val, const p_tlist& li);
    p_bool getValue() override;
+   p_bool isFoldable() const override;
 
 private:
    p_genptr<p_tim> value;
@@ -45,6 +45,8 @@ protected:
    p_bool hasSpecialStart() const;
    p_size getMinLength(const p_str& pat) const override;
    Logic checkState(const p_size n, const p_size m) override;
+   WildcardElement getElement(const p_size index) const override;
+   p_bool canJumpOver(const p_size index) const override;
 
 private:
    const p_str prefix;
@@ -37,6 +37,16 @@ public:
       return true;
    };
 
+   p_bool isFoldable() const override
+   {
+      return true;
+   };
+
+   const T* getAddress() const override
+   {
+      return &value;
+   };
+
 private:
    const T value;
 };
@@ -48,6 +58,11 @@ struct UnaryOperation : Generator<T>
 public:
    UnaryOperation<T> (p_genptr<T>& val) : value(std::move(val)) { };
 
+   p_bool isFoldable() const override
+   {
+      return this->value->isFoldable();
+   };
+
 protected:
    p_genptr<T> value;
 };
@@ -60,6 +75,11 @@ public:
    BinaryOperation<T> (p_genptr<T>& val1, p_genptr<T>& val2)
       : value1(std::move(val1)), value2(std::move(val2)) { };
 
+   p_bool isFoldable() const override
+   {
+      return this->value1->isFoldable() && this->value2->isFoldable();
+   };
+
 protected:
    p_genptr<T> value1;
    p_genptr<T> value2;
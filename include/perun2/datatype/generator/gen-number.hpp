@@ -75,6 +75,7 @@ public:
    TimeMember() = delete;
    TimeMember(p_genptr<p_tim>& tim, const Period::PeriodUnit pu);
    p_num getValue() override;
+   p_bool isFoldable() const override;
 
 protected:
    p_genptr<p_tim> time;
@@ -0,0 +1,121 @@
+/*
+    This file is part of Perun2.
+    Perun2 is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    Perun2 is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with Perun2. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include "gen-os-gen.hpp"
+#include "../primitives.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace perun2
+{
+struct Perun2Process;
+}
+
+namespace perun2::gen
+{
+
+// with the flag -p, recursive definitions are iterated by many threads at once
+// every thread has its own queue of directories to read
+// when it runs out of work, it steals a directory from another thread
+// found elements go to a bounded queue, which is drained by the definition
+// their order is not specified, just like for a file system that returns directories in any order
+//
+// there is one pool of threads for the whole process, started by the first walk
+// it serves one definition at a time, so the definitions nested inside it are traversed sequentially
+
+p_constexpr p_size PARALLEL_WALKER_MIN_THREADS = 2;
+p_constexpr p_size PARALLEL_WALKER_MAX_THREADS = 16;
+p_constexpr p_size PARALLEL_WALKER_QUEUE_CAPACITY = 1024;
+p_constexpr p_int PARALLEL_WALKER_IDLE_MS = 2;
+
+
+struct WalkerEntry
+{
+   p_str path;
+   p_fdata data;
+};
+
+
+struct WalkerQueue
+{
+   std::mutex mutex;
+   std::deque<p_str> directories;
+};
+
+
+struct ParallelWalker
+{
+public:
+   ParallelWalker() = delete;
+   ParallelWalker(Perun2Process& p2);
+   ~ParallelWalker();
+
+   // no definition is being walked now
+   p_bool isFree() const;
+
+   void start(const void* owner, const OsElement el, const p_str& root);
+
+   // does nothing if this owner is not the one being walked
+   void stop(const void* owner);
+
+   // wait for the next element
+   // its path is relative to the root
+   p_bool next(p_str& path, p_fdata& data);
+
+private:
+   void run(const p_size id);
+   void work(const p_size id);
+   void readDirectory(const p_size id, const p_str& directory);
+   p_bool takeDirectory(const p_size id, p_str& result);
+   void addDirectory(const p_size id, const p_str& directory);
+   p_bool addEntry(const p_str& path, const p_fdata& data);
+   p_bool accepts(const p_bool isDirectory, const p_str& name) const;
+
+   const p_bool noOmit;
+   Perun2Process& perun2;
+   const void* owner = nullptr;
+   OsElement element = OsElement::oe_None;
+   p_str rootPath;
+
+   std::vector<std::thread> threads;
+   std::vector<std::unique_ptr<WalkerQueue>> queues;
+   std::atomic<p_size> pendingDirectories;
+   std::atomic<p_size> activeThreads;
+   std::atomic<p_bool> stopped;
+   std::mutex idleMutex;
+   std::condition_variable idleCondition;
+
+   // the threads wait here for the next walk
+   // and stop() waits here for the end of the current one
+   std::mutex walkMutex;
+   std::condition_variable walkCondition;
+   p_size walkId = 0;
+   p_bool closed = false;
+
+   std::deque<WalkerEntry> entries;
+   std::mutex entriesMutex;
+   std::condition_variable entriesNotEmpty;
+   std::condition_variable entriesNotFull;
+   p_bool finished = true;
+};
+}
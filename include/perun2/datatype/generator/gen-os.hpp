@@ -16,6 +16,8 @@
 
 #include "../patterns.hpp"
 #include "../text/wildcard.hpp"
+#include "gen-os-gen.hpp"
+#include "gen-os-parallel.hpp"
 #include "../../os/os.hpp"
 #include "../../arguments.hpp"
 #include "../../context/ctx-file.hpp"
@@ -97,17 +99,37 @@ struct OsDefinitionRecursive : OsDefinition
 {
 public:
    OsDefinitionRecursive() = delete;
-   OsDefinitionRecursive(P_GEN_OS_ARGS)
-      : OsDefinition(P_GEN_OS_ARGS_2) { };
+   OsDefinitionRecursive(P_GEN_OS_ARGS, const OsElement el);
+
+   ~OsDefinitionRecursive();
 
    p_bool setAction(p_daptr& act) override;
    void reset() override;
 
 protected:
+   // whether this iteration goes through the parallel walker
+   // it is decided at the start of every iteration, as the walker may be busy with another definition
+   p_bool usesWalker();
+   p_bool parallelHasNext();
+
+   // the path of the current directory and its part relative to the base location
+   // are kept in two buffers that only grow and shrink at their ends
+   // so no directory path is built from scratch for every entry
+   void enterDirectory(const p_str& name);
+   p_bool leaveDirectory();
+   p_bool openDirectory();
+
    p_bool goDeeper = false;
    std::vector<p_entry> handles;
-   p_list paths;
-   p_list bases;
+   p_str path;
+   p_str base;
+   std::vector<p_size> pathLengths;
+   std::vector<p_size> baseLengths;
+
+   // the walker of the process, only with the flag -p
+   const OsElement element;
+   ParallelWalker* walker = nullptr;
+   p_bool walking = false;
 };
 
 
@@ -155,7 +177,7 @@ struct RecursiveFiles : OsDefinitionRecursive
 public:
    RecursiveFiles() = delete;
    RecursiveFiles(P_GEN_OS_ARGS)
-      : OsDefinitionRecursive(P_GEN_OS_ARGS_2) { };
+      : OsDefinitionRecursive(P_GEN_OS_ARGS_2, OsElement::oe_RecursiveFiles) { };
 
    p_bool hasNext() override;
 };
@@ -166,7 +188,7 @@ struct RecursiveDirectories : OsDefinitionRecursive
 public:
    RecursiveDirectories() = delete;
    RecursiveDirectories(P_GEN_OS_ARGS)
-      : OsDefinitionRecursive(P_GEN_OS_ARGS_2) { };
+      : OsDefinitionRecursive(P_GEN_OS_ARGS_2, OsElement::oe_RecursiveDirectories) { };
 
    p_bool hasNext() override;
 };
@@ -177,7 +199,7 @@ struct RecursiveAll : OsDefinitionRecursive
 public:
    RecursiveAll() = delete;
    RecursiveAll(P_GEN_OS_ARGS)
-      : OsDefinitionRecursive(P_GEN_OS_ARGS_2) { };
+      : OsDefinitionRecursive(P_GEN_OS_ARGS_2, OsElement::oe_RecursiveAll) { };
 
    p_bool hasNext() override;
 
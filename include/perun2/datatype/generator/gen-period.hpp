@@ -27,6 +27,7 @@ public:
    PeriodUnit() = delete;
    PeriodUnit(p_genptr<p_num>& val, Period::PeriodUnit un);
    p_per getValue() override;
+   p_bool isFoldable() const override;
 
 private:
    p_genptr<p_num> value;
@@ -58,6 +59,7 @@ public:
    TimeDifference() = delete;
    TimeDifference(p_genptr<p_tim>& val1, p_genptr<p_tim>& val2);
    p_per getValue() override;
+   p_bool isFoldable() const override;
 
 private:
    p_genptr<p_tim> value1;
@@ -71,6 +73,7 @@ public:
    NegatedPeriod() = delete;
    NegatedPeriod(p_genptr<p_per>& val);
    p_per getValue() override;
+   p_bool isFoldable() const override;
 
 private:
    p_genptr<p_per> value;
@@ -0,0 +1,109 @@
+/*
+    This file is part of Perun2.
+    Perun2 is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    Perun2 is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with Perun2. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include "../definition.hpp"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace perun2
+{
+struct Perun2Process;
+struct LocationContext;
+}
+
+namespace perun2::gen
+{
+
+// elements of definitions without their own file context are only strings
+// their attributes are loaded one by one in the order of iteration
+// and on a network drive or a cold disk, every such query waits for a long round-trip
+//
+// in the maximum performance mode, if the attributes of the elements are read at all,
+// the definition is read ahead by a few elements and these elements are queried by many threads at once
+// the read-ahead starts small and grows with the iteration, so a loop that ends early does not query much
+// their results are stored in the cache of attributes, where the iteration finds them
+// commands that alter the file system invalidate the cache, so no value can be outdated by them
+
+p_constexpr p_size PREFETCH_WINDOW = 8;
+p_constexpr p_size PREFETCH_THREADS = 8;
+
+
+struct PrefetchTask
+{
+   const void* owner;
+   p_str location;
+   p_str value;
+};
+
+
+// one pool of threads for the whole process
+// they are started by the first query and stopped when the process is destroyed
+struct AttributePrefetcher
+{
+public:
+   AttributePrefetcher() = delete;
+   AttributePrefetcher(Perun2Process& p2);
+   ~AttributePrefetcher();
+
+   void add(const void* owner, const p_str& location, const p_str& value);
+
+   // drop the queries of this owner that have not started yet
+   void cancel(const void* owner);
+
+private:
+   void work();
+
+   Perun2Process& perun2;
+   std::vector<std::thread> threads;
+   std::deque<PrefetchTask> pending;
+   std::mutex mutex;
+   std::condition_variable condition;
+   p_bool stopped = false;
+};
+
+
+struct DefPrefetch : Definition
+{
+public:
+   DefPrefetch() = delete;
+   DefPrefetch(p_defptr& def, FileContext* ctx, Perun2Process& p2);
+
+   p_bool hasNext() override;
+   void reset() override;
+   FileContext* getFileContext() override;
+   p_bool setAction(p_daptr& act) override;
+
+private:
+   p_defptr definition;
+   // the context that loads attributes of these elements
+   // they are known only after the whole script is parsed, so they are checked at the start of every iteration
+   FileContext* context;
+   Perun2Process& perun2;
+   LocationContext& locationContext;
+   AttributePrefetcher& prefetcher;
+   std::deque<p_str> values;
+   p_bool first = true;
+   p_bool exhausted = false;
+   p_bool prefetching = false;
+   p_size window = 0;
+};
+
+}
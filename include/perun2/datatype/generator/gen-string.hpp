@@ -33,10 +33,12 @@ struct ConcatString_2 : Generator<p_str>
 public:
    ConcatString_2(p_genptr<p_str>& v1, p_genptr<p_str>& v2);
    p_str getValue() override;
+   void writeValue(p_str& result) override;
 
 private:
    p_genptr<p_str> value1;
    p_genptr<p_str> value2;
+   p_str buffer;
 };
 
 
@@ -45,11 +47,13 @@ struct ConcatString_3 : Generator<p_str>
 public:
    ConcatString_3(p_genptr<p_str>& v1, p_genptr<p_str>& v2, p_genptr<p_str>& v3);
    p_str getValue() override;
+   void writeValue(p_str& result) override;
 
 private:
    p_genptr<p_str> value1;
    p_genptr<p_str> value2;
    p_genptr<p_str> value3;
+   p_str buffer;
 };
 
 
@@ -58,12 +62,14 @@ struct ConcatString_4 : Generator<p_str>
 public:
    ConcatString_4(p_genptr<p_str>& v1, p_genptr<p_str>& v2, p_genptr<p_str>& v3, p_genptr<p_str>& v4);
    p_str getValue() override;
+   void writeValue(p_str& result) override;
 
 private:
    p_genptr<p_str> value1;
    p_genptr<p_str> value2;
    p_genptr<p_str> value3;
    p_genptr<p_str> value4;
+   p_str buffer;
 };
 
 
@@ -72,6 +78,7 @@ struct ConcatString_5 : Generator<p_str>
 public:
    ConcatString_5(p_genptr<p_str>& v1, p_genptr<p_str>& v2, p_genptr<p_str>& v3, p_genptr<p_str>& v4, p_genptr<p_str>& v5);
    p_str getValue() override;
+   void writeValue(p_str& result) override;
 
 private:
    p_genptr<p_str> value1;
@@ -79,6 +86,7 @@ private:
    p_genptr<p_str> value3;
    p_genptr<p_str> value4;
    p_genptr<p_str> value5;
+   p_str buffer;
 };
 
 
@@ -87,6 +95,7 @@ struct ConcatString_6 : Generator<p_str>
 public:
    ConcatString_6(p_genptr<p_str>& v1, p_genptr<p_str>& v2, p_genptr<p_str>& v3, p_genptr<p_str>& v4, p_genptr<p_str>& v5, p_genptr<p_str>& v6);
    p_str getValue() override;
+   void writeValue(p_str& result) override;
 
 private:
    p_genptr<p_str> value1;
@@ -95,6 +104,7 @@ private:
    p_genptr<p_str> value4;
    p_genptr<p_str> value5;
    p_genptr<p_str> value6;
+   p_str buffer;
 };
 
 
@@ -103,9 +113,11 @@ struct ConcatString_Multi : Generator<p_str>
 public:
    ConcatString_Multi(std::vector<p_genptr<p_str>>& val);
    p_str getValue() override;
+   void writeValue(p_str& result) override;
 
 private:
    std::vector<p_genptr<p_str>> values;
+   p_str buffer;
 };
 
 
@@ -116,6 +128,7 @@ public:
       : condition(std::move(cond)), value(std::move(val)) { };
 
    p_str getValue() override;
+   void writeValue(p_str& result) override;
 
 private:
    p_genptr<p_bool> condition;
@@ -152,6 +165,7 @@ struct RetreatedPath : Generator<p_str>
 public:
    RetreatedPath(p_genptr<p_str>& val, const p_int retr);
    p_str getValue() override;
+   void writeValue(p_str& result) override;
 
 private:
    p_genptr<p_str> value;
@@ -28,6 +28,7 @@ public:
    IncreasedTime() = delete;
    IncreasedTime(p_genptr<p_tim>& tim, p_genptr<p_per>& per);
    p_tim getValue() override;
+   p_bool isFoldable() const override;
 
 private:
    p_genptr<p_tim> time;
@@ -41,6 +42,7 @@ public:
    DecreasedTime() = delete;
    DecreasedTime(p_genptr<p_tim>& tim, p_genptr<p_per>& per);
    p_tim getValue() override;
+   p_bool isFoldable() const override;
 
 private:
    p_genptr<p_tim> time;
@@ -53,6 +55,7 @@ struct v_Now : Variable<p_tim>
 public:
    v_Now() : Variable<p_tim>(VarType::vt_Special) { };
    p_tim getValue() override;
+   const p_tim* getAddress() const override { return nullptr; };
 };
 
 
@@ -61,6 +64,7 @@ struct v_Today : Variable<p_tim>
 public:
    v_Today() : Variable<p_tim>(VarType::vt_Special) { };
    p_tim getValue() override;
+   const p_tim* getAddress() const override { return nullptr; };
 };
 
 
@@ -69,6 +73,7 @@ struct v_Yesterday : Variable<p_tim>
 public:
    v_Yesterday() : Variable<p_tim>(VarType::vt_Special) { };
    p_tim getValue() override;
+   const p_tim* getAddress() const override { return nullptr; };
 };
 
 
@@ -77,6 +82,7 @@ struct v_Tomorrow : Variable<p_tim>
 public:
    v_Tomorrow() : Variable<p_tim>(VarType::vt_Special) { };
    p_tim getValue() override;
+   const p_tim* getAddress() const override { return nullptr; };
 };
 
 
@@ -101,6 +101,8 @@ p_constexpr p_char CHAR_z =                      L'z';
 p_constexpr p_char CHAR_Z =                      L'Z';
 p_constexpr p_char CHAR_o =                      L'o';
 p_constexpr p_char CHAR_O =                      L'O';
+p_constexpr p_char CHAR_i =                      L'i';
+p_constexpr p_char CHAR_I =                      L'I';
 
 p_constexpr p_char CHAR_0 =                      L'0';
 p_constexpr p_char CHAR_1 =                      L'1';
@@ -16,8 +16,8 @@
 
 #include "../datatype.hpp"
 #include "wildcard.hpp"
-#include <unordered_set>
 #include <unordered_map>
+#include <map>
 
 
 namespace perun2::gen
@@ -39,15 +39,33 @@ p_constexpr p_char WILDCARD_SET_END = CHAR_CLOSING_SQUARE_BRACKET;
 p_constexpr p_char WILDCARD_SET_EXCLUSION = CHAR_CARET;
 
 
+// the LIKE operator is compiled into a deterministic automaton lazily, state after state
+// if a pattern produces more states than this, the automaton is cleared and built again
+p_constexpr p_size LIKE_DFA_MAX_STATES = 1024;
+p_constexpr p_int LIKE_DFA_UNKNOWN = -1;
+p_constexpr p_size LIKE_ASCII_END = 128;
+p_constexpr p_size LIKE_BITS_IN_WORD = 64;
+
+
+struct LikeRange
+{
+   p_char first;
+   p_char last;
+};
+
+
 struct LikeSet
 {
 public:
    LikeSet() = delete;
-   LikeSet(const std::unordered_set<p_char>& vals, const p_bool neg);
+   LikeSet(const std::vector<LikeRange>& rngs, const p_bool neg);
    p_bool contains(const p_char ch) const;
 
+   // characters within which this set does not change its answer
+   void addBounds(std::vector<p_char>& bounds) const;
+
 private:
-   const std::unordered_set<p_char> values;
+   const std::vector<LikeRange> ranges;
    const p_bool negated;
 };
 
@@ -96,7 +114,10 @@ private:
 
 
 //  %exa[m-v]__pl_e%            complex pattern like this
-struct LC_Default : LikeComparer, WildcardComparer
+// every element of the pattern is a state of a nondeterministic automaton
+// characters are divided into classes that are treated the same way by all elements
+// and the deterministic automaton is built from them on demand
+struct LC_Default : LikeComparer
 {
 public:
    LC_Default() = delete;
@@ -104,12 +125,33 @@ public:
    LC_Default(const p_str& pat, const std::unordered_map<p_size, LikeSet>& cs);
    p_bool compareToPattern(const p_str& value) override;
 
-protected:
-   Logic checkState(const p_size n, const p_size m) override;
-   p_size getMinLength(const p_str& pat) const override;
-
 private:
-   const std::unordered_map<p_size, LikeSet> charSets;
+   void compile(const std::unordered_map<p_size, LikeSet>& cs);
+   p_size getClass(const p_char ch) const;
+   p_int getNextState(const p_int state, const p_size cls);
+   p_int addState(const std::vector<uint64_t>& positions);
+   void clearStates();
+
+   const p_str pattern;
+   const p_size patternLength;
+   const p_size wordsCount;
+   p_size minLength = 0;
+
+   // character classes
+   std::vector<p_char> bounds;
+   std::vector<p_size> asciiClasses;
+   p_bool hasDigits = false;
+   p_size classesCount = 0;
+
+   // element x class
+   std::vector<p_bool> elementMatches;
+
+   // states of the deterministic automaton and their transitions (state x class)
+   std::vector<std::vector<uint64_t>> states;
+   std::map<std::vector<uint64_t>, p_int> stateIds;
+   std::vector<p_int> transitions;
+   std::vector<p_bool> acceptingStates;
+   std::vector<p_bool> deadStates;
 };
 
 
@@ -15,20 +15,34 @@
 #pragma once
 
 #include "../primitives.hpp"
+#include <cstdint>
 
 namespace perun2
 {
 
-p_constexpr uint32_t TO_RAW_DOUBLECHARS_NONE               = 0;
-p_constexpr uint32_t TO_RAW_DOUBLECHARS_LOWER_OE           = 1 << 0;
-p_constexpr uint32_t TO_RAW_DOUBLECHARS_LOWER_AE           = 1 << 1;
-p_constexpr uint32_t TO_RAW_DOUBLECHARS_LOWER_AE_ACCENT    = 1 << 2;
-p_constexpr uint32_t TO_RAW_DOUBLECHARS_LOWER_AE_MACRON    = 1 << 3;
-p_constexpr uint32_t TO_RAW_DOUBLECHARS_UPPER_OE           = 1 << 4;
-p_constexpr uint32_t TO_RAW_DOUBLECHARS_UPPER_AE           = 1 << 5;
-p_constexpr uint32_t TO_RAW_DOUBLECHARS_UPPER_AE_ACCENT    = 1 << 6;
-p_constexpr uint32_t TO_RAW_DOUBLECHARS_UPPER_AE_MACRON    = 1 << 7;
-p_constexpr uint32_t TO_RAW_DOUBLECHARS_ESZETT             = 1 << 8;
+// characters are mapped through a two-level table of the Basic Multilingual Plane
+// a value of the table is a character, two characters (the second in high bits) or nothing
+p_constexpr uint32_t TO_RAW_MAX_CHAR =          0xFFFF;
+p_constexpr uint32_t TO_RAW_REMOVED =           0xFFFFFFFF;
+p_constexpr uint32_t TO_RAW_SECOND_SHIFT =      16;
+p_constexpr uint32_t TO_RAW_ASCII_END =         0x80;
+p_constexpr p_size TO_RAW_BLOCK_BITS =          8;
+p_constexpr p_size TO_RAW_BLOCK_SIZE =          1 << TO_RAW_BLOCK_BITS;
+p_constexpr p_size TO_RAW_BLOCKS =              (TO_RAW_MAX_CHAR + 1) / TO_RAW_BLOCK_SIZE;
+p_constexpr p_size TO_RAW_IDENTITY_BLOCK =      SIZE_MAX;
+
+
+struct RawTable
+{
+public:
+   RawTable();
+   uint32_t get(const p_char ch) const;
+
+private:
+   p_size blocks[TO_RAW_BLOCKS];
+   std::vector<std::vector<uint32_t>> changedBlocks;
+};
+
 
 // this function turns string into its "raw" format
 // it does 3 things:
@@ -38,10 +52,11 @@ p_constexpr uint32_t TO_RAW_DOUBLECHARS_ESZETT             = 1 << 8;
 // case size stays the same
 void str_toRaw(p_str& value);
 
-// replace certain char with a pair of chars
-// string is expanded every replacement
-inline static void replaceCharWithTwoChars(p_str& value, 
-   const p_char old, const p_char new1, const p_char new2);
+static const RawTable& getRawTable();
+
+// the raw form of one character, used only to build the table
+static uint32_t toRawChar(const p_char ch);
+inline static uint32_t toRawPair(const p_char first, const p_char second);
 
 inline static p_bool isCombiningMark(const p_char ch);
 
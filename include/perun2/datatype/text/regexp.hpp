@@ -16,11 +16,127 @@
 
 #include "../datatype.hpp"
 #include <regex>
+#include <list>
+#include <cstdint>
+#include <unordered_map>
 
 
 namespace perun2::gen
 {
 
+// the built-in engine simulates a Thompson automaton, so it runs in linear time for every input
+// patterns with features it does not support (backreferences, lookaheads...) use std::wregex
+p_constexpr p_size REGEXP_MAX_INSTRUCTIONS = 10000;
+p_constexpr p_size REGEXP_MAX_REPEATS = 1000;
+p_constexpr p_size REGEXP_INFINITY = SIZE_MAX;
+p_constexpr p_size REGEXP_CACHE_SIZE = 16;
+
+p_constexpr p_char REGEXP_ANY = CHAR_DOT;
+p_constexpr p_char REGEXP_ALTERNATION = CHAR_VERTICAL_BAR;
+p_constexpr p_char REGEXP_GROUP_START = CHAR_OPENING_ROUND_BRACKET;
+p_constexpr p_char REGEXP_GROUP_END = CHAR_CLOSING_ROUND_BRACKET;
+p_constexpr p_char REGEXP_CLASS_START = CHAR_OPENING_SQUARE_BRACKET;
+p_constexpr p_char REGEXP_CLASS_END = CHAR_CLOSING_SQUARE_BRACKET;
+p_constexpr p_char REGEXP_CLASS_NEGATION = CHAR_CARET;
+p_constexpr p_char REGEXP_CLASS_RANGE = CHAR_MINUS;
+p_constexpr p_char REGEXP_REPEAT_START = CHAR_OPENING_CURLY_BRACKET;
+p_constexpr p_char REGEXP_REPEAT_END = CHAR_CLOSING_CURLY_BRACKET;
+p_constexpr p_char REGEXP_REPEAT_SEPARATOR = CHAR_COMMA;
+p_constexpr p_char REGEXP_ZERO_OR_MORE = CHAR_ASTERISK;
+p_constexpr p_char REGEXP_ONE_OR_MORE = CHAR_PLUS;
+p_constexpr p_char REGEXP_OPTIONAL = CHAR_QUESTION_MARK;
+p_constexpr p_char REGEXP_START = CHAR_CARET;
+p_constexpr p_char REGEXP_END = L'$';
+p_constexpr p_char REGEXP_ESCAPE = CHAR_BACKSLASH;
+p_constexpr p_char REGEXP_NON_CAPTURING = CHAR_COLON;
+
+
+struct RegexpRange
+{
+   p_char first;
+   p_char last;
+};
+
+
+struct RegexpClass
+{
+public:
+   p_bool contains(const p_char ch) const;
+
+   std::vector<RegexpRange> ranges;
+   p_bool digits = false;
+   p_bool nonDigits = false;
+   p_bool words = false;
+   p_bool nonWords = false;
+   p_bool spaces = false;
+   p_bool nonSpaces = false;
+   p_bool negated = false;
+};
+
+
+enum RegexpOperation
+{
+   ro_Char = 0,
+   ro_Any,
+   ro_Class,
+   ro_Split,
+   ro_Jump,
+   ro_Start,
+   ro_End,
+   ro_WordBoundary,
+   ro_NotWordBoundary,
+   ro_Match
+};
+
+
+struct RegexpInstruction
+{
+   RegexpOperation operation;
+   p_char ch;
+   // the class of ro_Class, or targets of ro_Split and ro_Jump
+   p_size first;
+   p_size second;
+};
+
+
+// compiled regular expression
+// the lists of states are kept between searches, so a search does not allocate after the first ones
+struct RegexpProgram
+{
+public:
+   RegexpProgram() = delete;
+   RegexpProgram(const p_str& pat);
+   p_bool search(const p_str& value);
+
+private:
+   void addState(std::vector<p_size>& states, const p_size start, const p_str& value, const p_size position);
+   p_bool consumes(const RegexpInstruction& instruction, const p_char ch) const;
+
+   std::vector<RegexpInstruction> instructions;
+   std::vector<RegexpClass> classes;
+   p_bool anchored = false;
+   std::unique_ptr<std::wregex> fallback;
+
+   std::vector<p_size> currentStates;
+   std::vector<p_size> nextStates;
+   std::vector<p_size> pending;
+   std::vector<uint64_t> visited;
+   uint64_t generation = 0;
+};
+
+
+// the last used patterns of a regexp with a dynamic pattern
+struct RegexpCache
+{
+public:
+   RegexpProgram& get(const p_str& pattern);
+
+private:
+   typedef std::pair<p_str, RegexpProgram> p_rgxentry;
+   std::list<p_rgxentry> entries;
+   std::unordered_map<p_str, std::list<p_rgxentry>::iterator> positions;
+};
+
 
 struct Regexp : Generator<p_bool>
 {
@@ -31,6 +147,7 @@ public:
 private:
    p_genptr<p_str> value;
    p_genptr<p_str> pattern;
+   RegexpCache cache;
 };
 
 
@@ -42,7 +159,7 @@ public:
 
 private:
    p_genptr<p_str> value;
-   const std::wregex pattern;
+   RegexpProgram program;
 };
 
 
@@ -16,6 +16,8 @@
 
 #include "../datatype.hpp"
 #include "../generator.hpp"
+#include <unordered_map>
+#include <cstdint>
 
 
 namespace perun2::gen
@@ -28,6 +30,39 @@ p_constexpr p_ndouble RESEMBLANCE_RATIO =
    NDOUBLE_ONE - (NDOUBLE_ONE / static_cast<p_ndouble>(RESEMBLANCE_MISTAKES_ALLOWED));
 
 
+// patterns up to this length are compared with a bit-parallel algorithm
+p_constexpr p_size RESEMBLANCE_MAX_BIT_LENGTH = 64;
+p_constexpr p_size RESEMBLANCE_ASCII_END = 128;
+
+
+// pattern of the Resemblance algorithm, transformed and preprocessed only once
+struct ResemblancePattern
+{
+public:
+   ResemblancePattern() = delete;
+   ResemblancePattern(const p_str& pat);
+
+   // minimum of the Damerau-Levenshtein distances (optimal string alignment) between the pattern
+   // and any substring of the value
+   // the search stops as soon as a distance is not greater than the limit
+   p_int distance(const p_str& value, const p_int limit);
+   p_size size() const;
+
+private:
+   // Myers' algorithm extended by Hyyrö with transpositions
+   p_int bitDistance(const p_str& value, const p_int limit) const;
+   // the table of the dynamic programming, kept only three rows at a time
+   p_int tableDistance(const p_str& value, const p_int limit);
+   uint64_t getMask(const p_char ch) const;
+
+   p_str pattern;
+   p_size length;
+   std::vector<uint64_t> asciiMasks;
+   std::unordered_map<p_char, uint64_t> otherMasks;
+   std::vector<p_int> rows;
+};
+
+
 // operator RESEMBLES with pattern initialized with a string literal
 struct ResemblesConst : Generator<p_bool>
 {
@@ -37,7 +72,7 @@ public:
 
 private:
    p_genptr<p_str> value;
-   p_str pattern;
+   ResemblancePattern pattern;
    const p_int mistakesAllowed;
 };
 
@@ -52,6 +87,8 @@ public:
 private:
    p_genptr<p_str> value;
    p_genptr<p_str> pattern;
+   std::unique_ptr<ResemblancePattern> prepared;
+   p_str prevPattern;
 };
 
 
@@ -60,12 +97,7 @@ private:
 void prepareForResemblance(p_str& value);
 
 // the main Resemblance algorithm
-p_ndouble str_resemblance(const p_str& value, const p_str& pattern);
-
-// this implementation of Damerau-Levenshtein Distance calculates
-// minimum of the distances between str2 and any substring of str1 that starts at index 0
-// so, for str1='abcd', these substrings would be 'a', 'ab', 'abc' and 'abcd'
-static p_int multiDamerauLevenshteinDistance(const p_str& str1, const p_str& str2);
+p_ndouble str_resemblance(const p_str& value, ResemblancePattern& pattern);
 
 static p_int resemblanceMistakesAllowed(const p_str& pattern);
 
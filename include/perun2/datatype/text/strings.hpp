@@ -52,6 +52,9 @@ p_constexpr p_char STRING_FILE_OPEN_MODE[] =       L"rtS, ccs=UTF-8";
 p_constexpr p_char STRING_WINDOWS_PATH_PREFIX[] =  L"\\\\?\\";
 p_constexpr p_char STRING_POPUP_TITLE[] =          L"Perun2";
 p_constexpr p_char STRING_GOOD[] =                 L"good";
+p_constexpr p_char STRING_DATA_DIRECTORY[] =       L"Perun2";
+p_constexpr p_char STRING_SIZE_INDEX_FILE[] =      L"size-index.dat";
+p_constexpr p_char STRING_TEMPORARY_FILE_SUFFIX[] = L".tmp";
 
 p_constexpr p_char EMPTY_STRING[] =                L"";
 p_constexpr p_char STRING_NO_PERIOD[] =            L"no period";
@@ -346,12 +349,5 @@ extern const p_list STRINGS_TIME_ATTR;
 extern const p_list STRINGS_TIME_VAR;
 extern const p_list STRINGS_ALTERABLE_ATTR;
 extern const p_list STRINGS_VARS_IMMUTABLES;
-extern const p_list STRINGS_FUNC_BOO_STR;
-extern const p_list STRINGS_FUNC_NUM_NUM;
-extern const p_list STRINGS_AGGRFUNC;
-extern const p_list STRINGS_FUNC_STR_STR;
-extern const p_list STRINGS_FUNC_STR_STR_NUM;
-extern const p_list STRINGS_FUNC_STR_NUM;
-extern const p_list STRINGS_FUNC_TIM_NUM;
 
 }
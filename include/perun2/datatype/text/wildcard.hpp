@@ -16,12 +16,41 @@
 
 #include "../primitives.hpp"
 #include "../../logic.hpp"
+#include <unordered_map>
+#include <cstdint>
 
 
 namespace perun2
 {
 
 
+// patterns with at most this many elements are matched by a bit-parallel simulation
+// of their nondeterministic automaton (one bit for every position between elements)
+// longer patterns fall back to the table of memoized states
+p_constexpr p_size WILDCARD_MAX_BIT_ELEMENTS = 63;
+p_constexpr p_size WILDCARD_ASCII_END = 128;
+
+
+// how an element of a pattern consumes characters
+enum WildcardElement
+{
+   we_Literal = 0,
+   // sequences that can be empty:
+   we_AnyChars,
+   we_NonSeparatorChars,
+   we_DigitsAndDots
+};
+
+
+struct WildcardMasks
+{
+   // positions that move forward after this character
+   uint64_t steps;
+   // positions that consume this character and stay where they are
+   uint64_t loops;
+};
+
+
 // base struct for pattern matching
 struct WildcardComparer
 {
@@ -33,14 +62,40 @@ public:
 protected:
    void clearCharStates();
 
+   // derived structs call it in their constructors, once the pattern can be described
+   // the first characters of every value can be skipped, if they are known to match already
+   void compileBits(const p_size start);
+
    virtual p_size getMinLength(const p_str& pat) const = 0;
    virtual Logic checkState(const p_size n, const p_size m) = 0;
+   virtual WildcardElement getElement(const p_size index) const = 0;
+
+   // an empty sequence can be jumped over together with the element before it
+   // for example, a/**/b matches a/b
+   virtual p_bool canJumpOver(const p_size index) const;
 
    const p_str pattern;
    const p_size patternLength;
    p_size minLength = 0;
    p_str const* valuePtr = nullptr;
    std::vector<std::vector<Logic>> charStates;
+
+   p_bool bitParallel = false;
+   uint64_t startBits = 0;
+
+private:
+   p_bool matchesBits(const p_str& val);
+   uint64_t closeBits(uint64_t bits, const p_bool jumps) const;
+   void makeMasks(const p_char ch, WildcardMasks& masks) const;
+   const WildcardMasks& getMasks(const p_char ch);
+
+   p_size bitStart = 0;
+   uint64_t emptyBits = 0;
+   uint64_t jumpBits = 0;
+   uint64_t finalBit = 0;
+   std::vector<WildcardElement> elements;
+   std::vector<WildcardMasks> asciiMasks;
+   std::unordered_map<p_char, WildcardMasks> otherMasks;
 };
 
 
@@ -55,6 +110,7 @@ public:
 protected:
    p_size getMinLength(const p_str& pat) const override;
    Logic checkState(const p_size n, const p_size m) override;
+   WildcardElement getElement(const p_size index) const override;
 };
 
 
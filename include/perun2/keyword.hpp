@@ -15,7 +15,6 @@
 #pragma once
 
 #include "datatype/primitives.hpp"
-#include <unordered_map>
 
 
 namespace perun2
@@ -103,13 +102,130 @@ enum Keyword
 };
 
 
-struct KeywordsData
+enum Function
 {
-public:
-   KeywordsData();
-   const std::unordered_map<p_str, Keyword> KEYWORDS;
-   const std::unordered_map<p_str, p_nint> MONTHS;
-   const std::unordered_map<p_str, p_nint> WEEKDAYS;
+   fn_null = -1,
+      // boolean:
+   fn_IsLower = 0,
+   fn_IsUpper,
+   fn_IsNumber,
+   fn_IsLetter,
+   fn_IsDigit,
+   fn_IsBinary,
+   fn_IsHex,
+   fn_ExistInside,
+   fn_AnyInside,
+   fn_Any,
+   fn_Exist,
+   fn_Exists,
+   fn_Contains,
+   fn_ExistsInside,
+   fn_StartsWith,
+   fn_EndsWith,
+   fn_FindText,
+   fn_IsNan,
+   fn_IsNever,
+   fn_AskPython,
+   fn_AskPython3,
+      // numeric:
+   fn_Absolute,
+   fn_Ceil,
+   fn_Floor,
+   fn_Round,
+   fn_Sign,
+   fn_Sqrt,
+   fn_Truncate,
+   fn_Length,
+   fn_FromBinary,
+   fn_FromHex,
+   fn_Size,
+   fn_Number,
+   fn_CountInside,
+   fn_Count,
+   fn_Power,
+   fn_ShiftMonth,
+   fn_ShiftWeekDay,
+   fn_Resemblance,
+      // aggregate:
+   fn_Average,
+   fn_Sum,
+   fn_Min,
+   fn_Max,
+   fn_Median,
+      // period:
+   fn_Duration,
+      // string:
+   fn_After,
+   fn_Before,
+   fn_Digits,
+   fn_Letters,
+   fn_Lower,
+   fn_Trim,
+   fn_Upper,
+   fn_Reverse,
+   fn_AfterDigits,
+   fn_AfterLetters,
+   fn_BeforeDigits,
+   fn_BeforeLetters,
+   fn_Capitalize,
+   fn_Parent,
+   fn_Raw,
+   fn_Reversed,
+   fn_Repeat,
+   fn_Left,
+   fn_Right,
+   fn_Fill,
+   fn_Replace,
+   fn_Substring,
+   fn_Concatenate,
+   fn_Path,
+   fn_String,
+   fn_Roman,
+   fn_Binary,
+   fn_Hex,
+   fn_MonthName,
+   fn_WeekDayName,
+   fn_Join,
+      // time:
+   fn_Christmas,
+   fn_Easter,
+   fn_NewYear,
+   fn_Date,
+   fn_Time,
+   fn_Clock,
+      // list:
+   fn_Characters,
+   fn_Words,
+   fn_Split,
+      // numeric list:
+   fn_Numbers,
+      // several types:
+   fn_First,
+   fn_Last,
+   fn_Random
 };
 
+
+enum WordKind
+{
+   wk_None = 0,
+   wk_Keyword,
+   wk_Month,
+   wk_WeekDay,
+   wk_Function
+};
+
+
+struct WordId
+{
+   WordKind kind;
+   // a Keyword, a Function, or the number of a month or of a weekday
+   p_int value;
+};
+
+
+// keywords, function names, months and weekdays are found in a perfect hash table built at compile time
+// the word is compared case-insensitively, so the lexer does not have to make its lowercase copy first
+WordId keyword_find(const p_char* text, const p_size length);
+
 }
@@ -29,6 +29,8 @@ inline static p_bool isSpace(const p_char ch);
 inline static p_bool isNewLine(const p_char ch);
 inline static p_bool isAllowedInWord(const p_char ch);
 inline static p_bool isDoubleChar(const p_char ch);
+inline static p_size skipWord(const p_str& code, p_size start);
+inline static p_size skipUntil(const p_str& code, const p_size start, const p_char ch, p_int& line);
 inline static p_nint fileSizeSuffixMulti(const p_char ch1, const p_char ch2);
 inline static p_nint decimalSuffixMulti(const p_char ch);
 
@@ -21,6 +21,8 @@
 namespace perun2
 {
 
+struct CacheUnit;
+
 // while sleeping
 // check every 300 ms if the program received an interruption signal
 p_constexpr p_nint OS_SLEEP_UNIT = NINT_300;
@@ -66,6 +68,7 @@ p_str os_quoteEmbraced(const p_str& value);
 
 static p_str os_toWideString(const std::string& str);
 MediaAttributes os_ffmpegAttributes(const p_str& filePath);
+MediaAttributes os_ffmpegAttributes(const p_str& filePath, CacheUnit* unit);
 static p_per os_ffmpegPeriod(const int64_t units);
 static bool os_isFfmpegVideoFormat(const std::string& value);
 static bool os_isFfmpegImageFormat(const std::string& value);
@@ -17,11 +17,15 @@
 #include "../side-process.hpp"
 #include "../datatype/incr-constr.hpp"
 #include "../attribute.hpp"
+#include "../size-index.hpp"
 
 
 namespace perun2
 {
 
+struct CacheUnit;
+struct Cache;
+
 
 // default file path separator
 // in Windows OS, this separator is \ and the 'wrong separator' is /
@@ -48,6 +52,10 @@ void os_rawSleepForMs(const p_nint ms);
 void os_loadAttributes(FileContext& context);
 void os_loadDataAttributes(FileContext& context, const p_fdata& data);
 
+// query attributes ahead of time and store them in the cache of attributes
+// the next query of the same path is answered from there
+void os_prefetchAttributes(const p_str& path, Cache& cache);
+
 // get values of filesystem variables:
 p_tim os_access(const p_str& path);
 p_bool os_archive(const p_str& path);
@@ -59,6 +67,7 @@ p_str os_drive(const p_str& path);
 p_bool os_empty(const p_str& path);
 p_bool os_emptyFile(const p_adata& data);
 p_bool os_emptyDirectory(const p_str& path);
+p_bool os_emptyDirectory(const p_str& path, CacheUnit* unit);
 p_bool os_encrypted(const p_str& path);
 p_bool os_hasAttribute(const p_str& path, const DWORD attribute);
 p_bool os_hidden(const p_str& path);
@@ -71,8 +80,22 @@ p_bool os_readonly(const p_str& path);
 p_num os_size(const p_str& path, Perun2Process& p2);
 p_num os_sizeFile(const p_str& path);
 p_num os_sizeDirectory(const p_str& path, Perun2Process& p2);
+p_num os_sizeDirectory(const p_str& path, CacheUnit* unit, Perun2Process& p2);
 p_bool os_sizeDirectorySatisfies(const p_str& path, IncrementalConstraint& constr, Perun2Process& p2);
 
+// directory sizes read with help of the persistent size index
+// only directories modified since they were indexed are enumerated again
+// the others cost one attribute query each
+// subtrees are measured by multiple threads once enough directories are waiting
+p_constexpr p_size OS_PARALLEL_SIZE_MIN_DIRECTORIES = 4;
+p_constexpr p_size OS_PARALLEL_SIZE_MIN_THREADS = 2;
+p_constexpr p_size OS_PARALLEL_SIZE_MAX_THREADS = 16;
+
+p_bool os_indexedDirectory(const p_str& path, SizeIndex& index, SizeIndexEntry& result);
+void os_sizeDirectoriesParallel(p_list& paths, p_nint& totalSize, IncrementalConstraint* constr, Perun2Process& p2);
+p_num os_sizeDirectoryIndexed(const p_str& path, Perun2Process& p2);
+p_bool os_sizeDirectorySatisfiesIndexed(const p_str& path, IncrementalConstraint& constr, Perun2Process& p2);
+
 p_bool os_exists(const p_str& path);
 p_bool os_fileExists(const p_str& path);
 p_bool os_directoryExists(const p_str& path);
@@ -81,6 +104,21 @@ p_bool os_hasFirstFile(const p_str& path, p_entry& entry, p_fdata& output);
 p_bool os_hasNextFile(p_entry& entry, p_fdata& output);
 void os_closeEntry(p_entry& entry);
 
+// files of at least this size are copied without the system cache
+// so copying them does not push everything else out of the memory
+p_constexpr p_nint OS_UNBUFFERED_COPY_MIN_SIZE = 256LL * 1024LL * 1024LL;
+
+// in the maximum performance mode, files inside a copied directory are copied by multiple threads
+// the amount of bytes copied at the same time is limited, so large files do not compete for the disk
+p_constexpr p_size OS_PARALLEL_COPY_THREADS = 8;
+p_constexpr p_size OS_PARALLEL_COPY_QUEUE_CAPACITY = 4096;
+p_constexpr p_nint OS_PARALLEL_COPY_MAX_BYTES_IN_FLIGHT = 512LL * 1024LL * 1024LL;
+
+// in the maximum performance mode, a dropped directory is taken apart by multiple threads
+// files of one directory are deleted in batches, so even a single large directory is shared
+p_constexpr p_size OS_PARALLEL_DROP_THREADS = 8;
+p_constexpr p_size OS_PARALLEL_DROP_BATCH_SIZE = 64;
+
 // filesystem operations:
 // some of them take a reference to the running Perun2 instance
 // they can be stopped safely by an interruption signal during operation
@@ -104,7 +142,10 @@ p_bool os_createDirectory(const p_str& path);
 
 p_bool os_moveTo(const p_str& oldPath, const p_str& newPath);
 p_bool os_copyTo(const p_str& oldPath, const p_str& newPath, const p_bool isFile, Perun2Process& p2);
-p_bool os_copyToFile(const p_str& oldPath, const p_str& newPath);
+p_bool os_copyToFile(const p_str& oldPath, const p_str& newPath, Perun2Process& p2);
+p_bool os_copyToFile(const p_str& oldPath, const p_str& newPath, const p_nint size, Perun2Process& p2);
+DWORD CALLBACK os_copyProgress(LARGE_INTEGER totalSize, LARGE_INTEGER totalTransferred, LARGE_INTEGER streamSize,
+   LARGE_INTEGER streamTransferred, DWORD streamNumber, DWORD reason, HANDLE source, HANDLE destination, LPVOID data);
 p_bool os_copyToDirectory(const p_str& oldPath, const p_str& newPath, Perun2Process& p2);
 
 p_bool os_copy(const p_set& paths);
@@ -175,6 +216,10 @@ p_list os_pendrives();
 p_str os_currentPath();
 p_str os_system32Path();
 p_str os_downloadsPath();
+
+// return an empty string if there is no place for the size index
+p_str os_sizeIndexPath();
+p_bool os_replaceFile(const p_str& oldPath, const p_str& newPath);
 Python3State os_getPython3(p_str& cmdPath);
 
 p_bool os_readFile(p_str& result, const p_str& path);
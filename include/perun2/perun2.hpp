@@ -27,6 +27,11 @@
 #include "context/ctx-main.hpp"
 #include "logger.hpp"
 #include "post-parse-data.hpp"
+#include "size-index.hpp"
+#include "cache.hpp"
+#include "arena.hpp"
+#include "datatype/generator/gen-prefetch.hpp"
+#include <atomic>
 
 
 namespace perun2
@@ -72,6 +77,7 @@ public:
    ~Perun2Process() noexcept;
 
    // perform all parsing and then run all parsed commands if parsing succeeded
+   // once parsed, the commands are run again without parsing on every next call
    p_bool run();
    
    // perform all parsing, but do not run any command
@@ -85,24 +91,35 @@ public:
    ExecutionType getExecutionType() const;
 
    const Arguments& arguments;
+   // declared before everything that owns parsed nodes, so it is destroyed after them
+   Arena arena;
    ConsoleSettings consoleSettings;
    Math math;
    Contexts contexts;
-   const KeywordsData keywordsData;
    SideProcess sideProcess;
    const p_flags flags;
    comm::ConditionContext conditionContext;
-   State state = State::s_Running;
+   // worker threads read it, while the main thread and terminate() write it
+   std::atomic<State> state { State::s_Running };
    int exitCode = EXITCODE_OK;
    Logger logger;
    PostParseData postParseData;
    comm::Python3Processes python3Processes;
+   SizeIndex sizeIndex;
+   Cache cache;
+   // declared after the cache, as its threads write there until they are stopped
+   gen::AttributePrefetcher prefetcher;
+   // the recursive definitions that use it are destroyed with the commands, before it
+   gen::ParallelWalker walker;
 
 private:
    p_bool preParse();
    p_bool parse();
    p_bool postParse();
    p_bool runCommands();
+   p_bool isPrepared();
+   void resetParsing();
+   void resetState();
 
 // count how many Perun2 processes are there globally
    static p_int globalCount;
@@ -113,6 +130,9 @@ private:
    std::vector<Token> tokens;
    ExecutionType executionType = ExecutionType::et_None;
    Terminator terminator;
+
+   // the parsed commands can be run again
+   p_bool prepared = false;
 };
 
 
@@ -133,6 +153,9 @@ public:
    // perform all parsing and then run all parsed commands if parsing succeeded
    p_bool run();
 
+   // the same, but in another location
+   p_bool run(const p_str& location);
+
    // perform all parsing, but do not run any command
    p_bool staticallyAnalyze();
 
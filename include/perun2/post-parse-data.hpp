@@ -55,6 +55,9 @@ public:
    PostParseData(Perun2Process& p2);
 
    void actualize(const Token& tk);
+   void reset();
+   p_bool refresh();
+   p_bool isLoaded(const p_cunit v) const;
    void loadCmdPath();
    Python3State getPython3State(p_str& cmdPath);
    p_str getPython3AskerPath();
@@ -33,6 +33,7 @@ public:
 protected:
    p_size getMinLength(const p_str& pat) const override;
    Logic checkState(const p_size n, const p_size m) override;
+   WildcardElement getElement(const p_size index) const override;
 };
 
 
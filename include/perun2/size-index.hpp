@@ -0,0 +1,72 @@
+/*
+    This file is part of Perun2.
+    Perun2 is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    Perun2 is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with Perun2. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include "arguments.hpp"
+#include "datatype/datatype.hpp"
+#include <unordered_map>
+#include <mutex>
+
+
+namespace perun2
+{
+
+
+// what is known about one directory
+// the total size of files directly inside and the names of subdirectories
+// stay valid as long as the directory itself has not been modified
+struct SizeIndexEntry
+{
+   p_nint creation;
+   p_nint modification;
+   p_nint filesSize;
+   p_list directories;
+};
+
+
+// persistent index of directory sizes
+// it is used only when asked for with the flag -i, as its sizes are approximate
+// a file modified in place does not change the modification time of its directory
+// so its new size is noticed only after the directory itself changes
+struct SizeIndex
+{
+public:
+   SizeIndex() = delete;
+   SizeIndex(const p_flags flags);
+
+   p_bool isEnabled() const;
+
+   // entries are copied in and out, as the index can be used by multiple threads
+   // return false if the directory is unknown or has changed since it was indexed
+   p_bool find(const p_str& path, const p_nint creation, const p_nint modification, SizeIndexEntry& result);
+   void put(const p_str& path, const SizeIndexEntry& entry);
+
+   // write the index to the disk if anything has changed
+   void save();
+
+private:
+   void load();
+   void erase(const p_str& key);
+
+   const p_bool enabled;
+   p_bool loaded = false;
+   p_bool changed = false;
+   // paths are case-insensitive, so they are kept in their lowercase form
+   std::unordered_map<p_str, SizeIndexEntry> entries;
+   std::mutex mutex;
+};
+
+}
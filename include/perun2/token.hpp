@@ -66,6 +66,9 @@ union TokenValue
    // keyword - important syntax element (print, if, copy...)
    Keyword keyword;
 
+   // word - the function it names (lower, count, exists...) or fn_null
+   Function function;
+
 
    // constructors:
    TokenValue();
@@ -73,6 +76,7 @@ union TokenValue
    TokenValue(const p_char ch, const p_int am);
    TokenValue(const p_num& n, const NumberMode nm);
    TokenValue(const Keyword k);
+   TokenValue(const Function f);
 };
 
 
@@ -97,6 +101,7 @@ public:
    Token(const p_num& v, const NumberMode nm, const p_int li, const p_str& o);
    Token(const Type type, const p_int li, const p_str& o);
    Token(const Keyword v, const p_int li, const p_str& o);
+   Token(const Function v, const p_int li, const p_str& o);
    Token(const p_int li, const p_str& o, const p_str& o2);
 
    p_bool isCommandKeyword() const;
@@ -104,6 +109,7 @@ public:
    p_bool isExpForbiddenKeyword() const;
    p_bool isSymbol(const p_char ch) const;
    p_bool isKeyword(const Keyword kw) const;
+   p_bool isFunction(const Function fn) const;
 
    // is single word (CREATION)
    p_bool isWord(const p_strv word) const;
@@ -45,11 +45,21 @@ namespace perun2
          return this->isConstant_;
       };
 
+      p_bool isFoldable() const override
+      {
+         return this->isConstant_ && this->isStable_;
+      };
+
       T getValue() override
       {
          return this->value;
       };
 
+      const T* getAddress() const override
+      {
+         return &this->value;
+      };
+
       p_bool isImmutable() const
       {
          return this->type != VarType::vt_User;
@@ -62,6 +72,8 @@ namespace perun2
 
       T value;
       p_bool isConstant_ = false;
+      // only special constants whose value does not change between runs
+      p_bool isStable_ = false;
       const VarType type;
    };
 
@@ -82,11 +94,21 @@ namespace perun2
          return this->variable.isConstant();
       };
 
+      p_bool isFoldable() const override
+      {
+         return this->variable.isFoldable();
+      };
+
       T getValue() override
       {
          return this->variable.getValue();
       };
 
+      const T* getAddress() const override
+      {
+         return this->variable.getAddress();
+      };
+
    private:
       Variable<T>& variable;
    };
@@ -0,0 +1,111 @@
+/*
+    This file is part of Perun2.
+    Perun2 is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    Perun2 is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with Perun2. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "../include/perun2/arena.hpp"
+#include <new>
+
+
+namespace perun2
+{
+
+static thread_local Arena* activeArena = nullptr;
+
+enum ArenaOrigin : unsigned char
+{
+   ao_Heap = 0,
+   ao_Arena
+};
+
+
+void* Arena::allocate(const p_size size)
+{
+   const p_size aligned = (size + ARENA_HEADER_SIZE - 1) & ~(ARENA_HEADER_SIZE - 1);
+
+   if (aligned > ARENA_MAX_SMALL_SIZE) {
+      // insert the big chunk before the current one, so the current one can still be filled
+      std::unique_ptr<unsigned char[]> big(new unsigned char[aligned]);
+      void* result = big.get();
+      const p_size position = this->chunks.empty() ? 0 : this->chunks.size() - 1;
+      this->chunks.insert(this->chunks.begin() + position, std::move(big));
+      return result;
+   }
+
+   if (this->used + aligned > this->capacity) {
+      this->chunks.emplace_back(new unsigned char[ARENA_CHUNK_SIZE]);
+      this->used = 0;
+      this->capacity = ARENA_CHUNK_SIZE;
+   }
+
+   void* result = this->chunks.back().get() + this->used;
+   this->used += aligned;
+   return result;
+}
+
+void Arena::reset()
+{
+   if (this->capacity == 0) {
+      this->chunks.clear();
+      return;
+   }
+
+   // the last chunk is always a standard one, as big chunks are inserted before it
+   std::unique_ptr<unsigned char[]> last = std::move(this->chunks.back());
+   this->chunks.clear();
+   this->chunks.push_back(std::move(last));
+   this->used = 0;
+}
+
+ArenaScope::ArenaScope(Arena& arena)
+   : previous(activeArena)
+{
+   activeArena = &arena;
+}
+
+ArenaScope::~ArenaScope() noexcept
+{
+   activeArena = this->previous;
+}
+
+
+void* ArenaNode::operator new(const std::size_t size)
+{
+   unsigned char* memory;
+
+   if (activeArena == nullptr) {
+      memory = static_cast<unsigned char*>(::operator new(size + ARENA_HEADER_SIZE));
+      *memory = ArenaOrigin::ao_Heap;
+   }
+   else {
+      memory = static_cast<unsigned char*>(activeArena->allocate(size + ARENA_HEADER_SIZE));
+      *memory = ArenaOrigin::ao_Arena;
+   }
+
+   return memory + ARENA_HEADER_SIZE;
+}
+
+void ArenaNode::operator delete(void* ptr) noexcept
+{
+   if (ptr == nullptr) {
+      return;
+   }
+
+   unsigned char* memory = static_cast<unsigned char*>(ptr) - ARENA_HEADER_SIZE;
+
+   if (*memory == ArenaOrigin::ao_Heap) {
+      ::operator delete(memory);
+   }
+}
+
+}
@@ -148,6 +148,16 @@ Arguments::Arguments(const p_int argc, p_char* const argv[])
                      this->flags |= FLAG_MAX_PERFORMANCE;
                      break;
                   }
+                  case CHAR_FLAG_SIZE_INDEX:
+                  case CHAR_FLAG_SIZE_INDEX_UPPER: {
+                     this->flags |= FLAG_SIZE_INDEX;
+                     break;
+                  }
+                  case CHAR_FLAG_PARALLEL:
+                  case CHAR_FLAG_PARALLEL_UPPER: {
+                     this->flags |= FLAG_PARALLEL;
+                     break;
+                  }
                   default: {
                      cmd::error::unknownOption(toStr(arg[j]));
                      return;
@@ -273,6 +283,11 @@ p_str Arguments::getLocation() const
    return this->location;
 }
 
+void Arguments::setLocation(const p_str& loc)
+{
+   this->location = loc;
+}
+
 p_str Arguments::getCode() const
 {
    return this->code;
@@ -55,6 +55,16 @@ void Attribute::add(const Token& tk)
       return;
    }
 
+   if (tk.isVariable(STRING_EXTENSION)) {
+      this->set(ATTR_EXTENSION);
+      return;
+   }
+
+   if (tk.isVariable(STRING_NAME)) {
+      this->set(ATTR_NAME);
+      return;
+   }
+
    this->set(ATTR_EXISTS);
    
    if (tk.isVariable(STRING_ACCESS)) {
@@ -81,9 +91,6 @@ void Attribute::add(const Token& tk)
    else if (tk.isVariable(STRING_ENCRYPTED)) {
       this->set(ATTR_ENCRYPTED);
    }
-   else if (tk.isVariable(STRING_EXTENSION)) {
-      this->set(ATTR_EXTENSION);
-   }
    else if (tk.isVariable(STRING_HIDDEN)) {
       this->set(ATTR_HIDDEN);
    }
@@ -95,9 +102,6 @@ void Attribute::add(const Token& tk)
    else if (tk.isVariable(STRING_MODIFICATION)) {
       this->set(ATTR_MODIFICATION);
    }
-   else if (tk.isVariable(STRING_NAME)) {
-      this->set(ATTR_NAME);
-   }
    else if (tk.isVariable(STRING_PARENT)) {
       this->set(ATTR_PARENT);
    }
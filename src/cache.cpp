@@ -12,17 +12,223 @@
     along with Perun2. If not, see <http://www.gnu.org/licenses/>.
 */
 
+
 #include "../include/perun2/cache.hpp"
+#include "../include/perun2/os/os.hpp"
 
 
 namespace perun2
 {
 
-Cache::Cache()
+// paths are not case sensitive
+// so they are compared in their lowercase form
+p_bool cache_contains(const p_str& parent, const p_str& child)
+{
+   if (child.size() <= parent.size() || child.compare(0, parent.size(), parent) != 0) {
+      return false;
+   }
+
+   return parent.back() == OS_SEPARATOR || child[parent.size()] == OS_SEPARATOR;
+}
+
+
+Cache::Cache(const p_flags flags)
+   : enabled(flags & FLAG_MAX_PERFORMANCE)
+{
+   if (this->enabled) {
+      this->elements.reserve(CACHE_SIZE);
+      this->realData.reserve(CACHE_SIZE);
+   }
+}
+
+CacheUnit* Cache::get(const p_str& path)
+{
+   if (!this->enabled || path.empty()) {
+      return nullptr;
+   }
+
+   const p_str key = str_lowercased(path);
+   auto it = this->elements.find(key);
+
+   if (it != this->elements.end()) {
+      const size_t index = it->second;
+      if (index != this->first) {
+         this->unlink(index);
+         this->pushFront(index);
+      }
+
+      return &this->realData[index];
+   }
+
+   size_t index;
+
+   if (this->realData.size() < CACHE_SIZE) {
+      index = this->realData.size();
+      this->realData.emplace_back();
+   }
+   else {
+      index = this->last;
+      this->unlink(index);
+      this->release(index);
+   }
+
+   this->realData[index].path = key;
+   this->elements.emplace(key, index);
+   this->pushFront(index);
+   this->takePrefetched(this->realData[index]);
+   return &this->realData[index];
+}
+
+void Cache::invalidate(const p_str& path)
+{
+   if (!this->enabled || path.empty()) {
+      return;
+   }
+
+   std::lock_guard<std::mutex> lock(this->prefetchMutex);
+   this->generation++;
+
+   if (this->elements.empty() && this->prefetched.empty()) {
+      return;
+   }
+
+   const p_str key = str_lowercased(path);
+
+   for (auto it = this->prefetched.begin(); it != this->prefetched.end(); ) {
+      if (it->first == key || cache_contains(key, it->first) || cache_contains(it->first, key)) {
+         it = this->prefetched.erase(it);
+      }
+      else {
+         it++;
+      }
+   }
+
+   for (size_t index = 0; index < this->realData.size(); index++) {
+      const p_str& unitPath = this->realData[index].path;
+
+      if (!unitPath.empty() && (unitPath == key 
+         || cache_contains(key, unitPath) || cache_contains(unitPath, key)))
+      {
+         // released units are reused before any other
+         this->unlink(index);
+         this->release(index);
+         this->pushBack(index);
+      }
+   }
+}
+
+void Cache::clear()
+{
+   if (!this->enabled) {
+      return;
+   }
+
+   this->elements.clear();
+   this->realData.clear();
+   this->first = CACHE_NO_UNIT;
+   this->last = CACHE_NO_UNIT;
+
+   std::lock_guard<std::mutex> lock(this->prefetchMutex);
+   this->generation++;
+   this->prefetched.clear();
+}
+
+p_size Cache::getGeneration()
+{
+   std::lock_guard<std::mutex> lock(this->prefetchMutex);
+   return this->generation;
+}
+
+void Cache::prefetch(const p_str& path, const p_size generation, const p_bool exists, const p_adata& data)
+{
+   if (!this->enabled || path.empty()) {
+      return;
+   }
+
+   const p_str key = str_lowercased(path);
+   std::lock_guard<std::mutex> lock(this->prefetchMutex);
+
+   // values that nobody has asked for are not kept forever
+   if (generation == this->generation && this->prefetched.size() < CACHE_MAX_PREFETCHED) {
+      this->prefetched[key] = { exists, data };
+   }
+}
+
+void Cache::takePrefetched(CacheUnit& unit)
+{
+   std::lock_guard<std::mutex> lock(this->prefetchMutex);
+   auto it = this->prefetched.find(unit.path);
+
+   if (it != this->prefetched.end()) {
+      unit.hasData = true;
+      unit.exists = it->second.exists;
+      unit.data = it->second.data;
+      this->prefetched.erase(it);
+   }
+}
+
+void Cache::unlink(const size_t index)
+{
+   CacheUnit& unit = this->realData[index];
+
+   if (unit.previous == CACHE_NO_UNIT) {
+      this->first = unit.next;
+   }
+   else {
+      this->realData[unit.previous].next = unit.next;
+   }
+
+   if (unit.next == CACHE_NO_UNIT) {
+      this->last = unit.previous;
+   }
+   else {
+      this->realData[unit.next].previous = unit.previous;
+   }
+
+   unit.previous = CACHE_NO_UNIT;
+   unit.next = CACHE_NO_UNIT;
+}
+
+void Cache::pushFront(const size_t index)
 {
-   
+   CacheUnit& unit = this->realData[index];
+   unit.next = this->first;
+
+   if (this->first == CACHE_NO_UNIT) {
+      this->last = index;
+   }
+   else {
+      this->realData[this->first].previous = index;
+   }
+
+   this->first = index;
 }
 
+void Cache::pushBack(const size_t index)
+{
+   CacheUnit& unit = this->realData[index];
+   unit.previous = this->last;
 
+   if (this->last == CACHE_NO_UNIT) {
+      this->first = index;
+   }
+   else {
+      this->realData[this->last].next = index;
+   }
+
+   this->last = index;
+}
+
+// the unit has to be unlinked first
+void Cache::release(const size_t index)
+{
+   CacheUnit& unit = this->realData[index];
+
+   if (!unit.path.empty()) {
+      this->elements.erase(unit.path);
+   }
+
+   unit = CacheUnit();
+}
 
 }
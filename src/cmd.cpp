@@ -55,7 +55,9 @@ void help()
    logger.print(L"  -h           Set working location to the place where this command was called from.");
    logger.print(L"  -n           Run in noomit mode (iterate all filesystem elements with no exceptions).");
    logger.print(L"  -s           Run in silent mode (no command log messages).");
-   logger.print(L"  -o           Maximum performance mode. The terminal is completely disabled.");
+   logger.print(L"  -o           Maximum performance mode. The terminal is completely disabled. File attributes are cached within a run.");
+   logger.print(L"  -p           Iterate recursive definitions with multiple threads. Their order is not specified.");
+   logger.print(L"  -i           Index directory sizes on the disk between runs. The sizes are approximate: a file changed in place is noticed only after its directory changes.");
    logger.print(L"  -m           Static analysis. Check code correctness without running it. Prints \"good\" if no error detected.");
 }
 
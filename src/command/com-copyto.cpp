@@ -54,6 +54,7 @@ void C_CopyTo::run()
    const p_str newPath = str(newLoc, OS_SEPARATOR, fulln);
 
    if (os_exists(newPath)) {
+      this->perun2.cache.invalidate(newPath);
       if (!(forced && !(this->context->v_isdirectory->value && os_isAncestor(oldPath, newPath))
          && os_drop(newPath, this->perun2))) 
       {
@@ -64,6 +65,7 @@ void C_CopyTo::run()
    }
 
    const p_bool s = os_copyTo(oldPath, newPath, this->context->v_isfile->value, this->perun2);
+   this->perun2.cache.invalidate(newPath);
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -119,6 +121,7 @@ void C_CopyTo_Stack::run()
    }
 
    const p_bool s = os_copyTo(oldPath, newPath, this->context->v_isfile->value, this->perun2);
+   this->perun2.cache.invalidate(newPath);
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -170,6 +173,7 @@ void C_CopyToAs::run()
    p_str newPath = str(newLoc, OS_SEPARATOR, fulln);
 
    if (os_exists(newPath)) {
+      this->perun2.cache.invalidate(newPath);
       if (!(forced && !(this->context->v_isdirectory->value && os_isAncestor(oldPath, newPath))
             && os_drop(newPath, this->perun2)))
       {
@@ -180,6 +184,7 @@ void C_CopyToAs::run()
    }
 
    const p_bool s = os_copyTo(oldPath, newPath, this->context->v_isfile->value, this->perun2);
+   this->perun2.cache.invalidate(newPath);
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -253,6 +258,7 @@ void C_CopyToAs_Stack::run()
    }
 
    const p_bool s = os_copyTo(oldPath, newPath, this->context->v_isfile->value, this->perun2);
+   this->perun2.cache.invalidate(newPath);
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -37,6 +37,7 @@ void C_Delete::run()
    P_CHECK_IF_PERUN2_IS_RUNNING;
 
    const p_bool s = this->context->v_exists->value && os_delete(this->context->v_path->value);
+   this->perun2.cache.invalidate(this->context->v_path->value);
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -53,6 +54,7 @@ void C_Drop::run()
    P_CHECK_IF_PERUN2_IS_RUNNING;
 
    const p_bool s = this->context->v_exists->value && os_drop(this->context->v_path->value, this->context->v_isfile->value, this->perun2);
+   this->perun2.cache.invalidate(this->context->v_path->value);
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -71,6 +73,7 @@ void C_Hide::run()
    P_CHECK_IF_PERUN2_IS_RUNNING;
 
    const p_bool s = this->context->v_exists->value && os_hide(this->context->v_path->value);
+   this->perun2.cache.invalidate(this->context->v_path->value);
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -89,6 +92,7 @@ void C_Lock::run()
    P_CHECK_IF_PERUN2_IS_RUNNING;
 
    const p_bool s = this->context->v_exists->value && os_lock(this->context->v_path->value);
+   this->perun2.cache.invalidate(this->context->v_path->value);
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -122,6 +126,7 @@ void C_Unlock::run()
    P_CHECK_IF_PERUN2_IS_RUNNING;
 
    const p_bool s = this->context->v_exists->value && os_unlock(this->context->v_path->value);
+   this->perun2.cache.invalidate(this->context->v_path->value);
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -140,6 +145,7 @@ void C_Unhide::run()
    P_CHECK_IF_PERUN2_IS_RUNNING;
 
    const p_bool s = this->context->v_exists->value && os_unhide(this->context->v_path->value);
+   this->perun2.cache.invalidate(this->context->v_path->value);
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -32,6 +32,7 @@ void C_Create::run()
    }
 
    if (this->context->v_exists->value) {
+      this->perun2.cache.invalidate(this->context->v_path->value);
       if (!(forced && os_drop(this->context->v_path->value, this->context->v_isfile->value, this->perun2))) {
          if (this->context->v_isfile->value) {
             this->perun2.logger.log(L"Failed to create file ", getCCName(this->context->v_path->value));
@@ -46,6 +47,7 @@ void C_Create::run()
 
    if (os_hasExtension(this->context->v_path->value)) {
       const p_bool s = os_createFile(this->context->v_path->value);
+      this->perun2.cache.invalidate(this->context->v_path->value);
       this->perun2.contexts.success->value = s;
 
       if (s) {
@@ -58,6 +60,7 @@ void C_Create::run()
    }
    else {
       const p_bool s = os_createDirectory(this->context->v_path->value);
+      this->perun2.cache.invalidate(this->context->v_path->value);
       this->perun2.contexts.success->value = s;
 
       if (s) {
@@ -99,6 +102,7 @@ void C_Create_Stack::run()
 
    if (hasExt) {
       const p_bool s = os_createFile(path);
+      this->perun2.cache.invalidate(path);
       this->perun2.contexts.success->value = s;
 
       if (s) {
@@ -114,6 +118,7 @@ void C_Create_Stack::run()
    }
    else {
       const p_bool s = os_createDirectory(path);
+      this->perun2.cache.invalidate(path);
       this->perun2.contexts.success->value = s;
 
       if (s) {
@@ -141,6 +146,7 @@ void C_CreateFile::run()
    }
 
    if (this->context->v_exists->value) {
+      this->perun2.cache.invalidate(this->context->v_path->value);
       if (!(forced && os_drop(this->context->v_path->value, this->context->v_isfile->value, this->perun2))) {
          this->perun2.logger.log(L"Failed to create file ", getCCName(this->context->v_path->value));
          this->perun2.contexts.success->value = false;
@@ -149,6 +155,7 @@ void C_CreateFile::run()
    }
 
    const p_bool s = os_createFile(this->context->v_path->value);
+   this->perun2.cache.invalidate(this->context->v_path->value);
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -188,6 +195,7 @@ void C_CreateFile_Stack::run()
    }
 
    const p_bool s = os_createFile(path);
+   this->perun2.cache.invalidate(path);
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -214,6 +222,7 @@ void C_CreateDirectory::run()
    }
 
    if (this->context->v_exists->value) {
+      this->perun2.cache.invalidate(this->context->v_path->value);
       if (!(forced && os_drop(this->context->v_path->value, this->context->v_isfile->value, this->perun2))) {
          this->perun2.logger.log(L"Failed to create directory ", getCCName(this->context->v_path->value));
          this->perun2.contexts.success->value = false;
@@ -222,6 +231,7 @@ void C_CreateDirectory::run()
    }
 
    const p_bool s = os_createDirectory(this->context->v_path->value);
+   this->perun2.cache.invalidate(this->context->v_path->value);
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -253,6 +263,7 @@ void C_CreateDirectory_Stack::run()
    }
 
    const p_bool s = os_createDirectory(path);
+   this->perun2.cache.invalidate(path);
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -293,6 +304,7 @@ void C_Create_String::run()
    }
 
    if (os_exists(path)) {
+      this->perun2.cache.invalidate(path);
       if (!(forced && os_drop(path, this->perun2))) {
          if (isFile) {
             this->perun2.logger.log(L"Failed to create file ", getCCName(path));
@@ -307,6 +319,7 @@ void C_Create_String::run()
 
    if (isFile) {
       const p_bool s = os_createFile(path);
+      this->perun2.cache.invalidate(path);
       this->perun2.contexts.success->value = s;
 
       if (s) {
@@ -318,6 +331,7 @@ void C_Create_String::run()
    }
    else {
       const p_bool s = os_createDirectory(path);
+      this->perun2.cache.invalidate(path);
       this->perun2.contexts.success->value = s;
 
       if (s) {
@@ -352,6 +366,7 @@ void C_CreateFile_String::run()
    }
 
    if (os_exists(path)) {
+      this->perun2.cache.invalidate(path);
       if (!(forced && os_drop(path, this->perun2))) {
          this->perun2.logger.log(L"Failed to create file ", getCCName(path));
          this->perun2.contexts.success->value = false;
@@ -360,6 +375,7 @@ void C_CreateFile_String::run()
    }
 
    const p_bool s = os_createFile(path);
+   this->perun2.cache.invalidate(path);
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -393,6 +409,7 @@ void C_CreateDirectory_String::run()
    }
 
    if (os_exists(path)) {
+      this->perun2.cache.invalidate(path);
       if (!(forced && os_drop(path, this->perun2))) {
          this->perun2.logger.log(L"Failed to create directory ", getCCName(path));
          this->perun2.contexts.success->value = false;
@@ -401,6 +418,7 @@ void C_CreateDirectory_String::run()
    }
 
    const p_bool s = os_createDirectory(path);
+   this->perun2.cache.invalidate(path);
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -448,6 +466,7 @@ void C_Create_String_Stack::run()
 
    if (hasExt) {
       const p_bool s = os_createFile(path);
+      this->perun2.cache.invalidate(path);
       this->perun2.contexts.success->value = s;
 
       if (s) {
@@ -459,6 +478,7 @@ void C_Create_String_Stack::run()
    }
    else {
       const p_bool s = os_createDirectory(path);
+      this->perun2.cache.invalidate(path);
       this->perun2.contexts.success->value = s;
 
       if (s) {
@@ -506,6 +526,7 @@ void C_CreateFile_String_Stack::run()
    }
 
    const p_bool s = os_createFile(path);
+   this->perun2.cache.invalidate(path);
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -543,6 +564,7 @@ void C_CreateDirectory_String_Stack::run()
    }
 
    const p_bool s = os_createDirectory(path);
+   this->perun2.cache.invalidate(path);
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -615,6 +637,7 @@ void C_Create_List::run()
       }
 
       if (os_exists(path)) {
+         this->perun2.cache.invalidate(path);
          if (!(forced && os_drop(path, this->perun2))) {
             if (isFile) {
                this->perun2.logger.log(L"Failed to create file ", getCCName(path));
@@ -629,6 +652,7 @@ void C_Create_List::run()
 
       if (os_hasExtension(n)) {
          const p_bool s = os_createFile(path);
+         this->perun2.cache.invalidate(path);
          this->perun2.contexts.success->value = s;
 
          if (s) {
@@ -641,6 +665,7 @@ void C_Create_List::run()
       }
       else {
          const p_bool s = os_createDirectory(path);
+         this->perun2.cache.invalidate(path);
          this->perun2.contexts.success->value = s;
 
          if (s) {
@@ -697,6 +722,7 @@ void C_CreateFiles_List::run()
          }
 
          if (os_exists(path)) {
+            this->perun2.cache.invalidate(path);
             if (!(forced && os_drop(path, this->perun2))) {
                this->perun2.logger.log(L"Failed to create file ", getCCName(path));
                success = false;
@@ -705,6 +731,7 @@ void C_CreateFiles_List::run()
          }
 
          const p_bool s = os_createFile(path);
+         this->perun2.cache.invalidate(path);
          this->perun2.contexts.success->value = s;
 
          if (s) {
@@ -761,6 +788,7 @@ void C_CreateDirectories_List::run()
          }
 
          if (os_exists(path)) {
+            this->perun2.cache.invalidate(path);
             if (!(forced && os_drop(path, this->perun2))) {
                this->perun2.logger.log(L"Failed to create directory ", getCCName(path));
                success = false;
@@ -769,6 +797,7 @@ void C_CreateDirectories_List::run()
          }
 
          const p_bool s = os_createDirectory(path);
+         this->perun2.cache.invalidate(path);
          this->perun2.contexts.success->value = s;
 
          if (s) {
@@ -846,6 +875,7 @@ void C_Create_List_Stack::run()
 
          if (hasExt) {
             const p_bool s = os_createFile(path);
+            this->perun2.cache.invalidate(path);
             this->perun2.contexts.success->value = s;
 
             if (s) {
@@ -858,6 +888,7 @@ void C_Create_List_Stack::run()
          }
          else {
             const p_bool s = os_createDirectory(path);
+            this->perun2.cache.invalidate(path);
             this->perun2.contexts.success->value = s;
 
             if (s) {
@@ -928,6 +959,7 @@ void C_CreateFiles_List_Stack::run()
          }
 
          const p_bool s = os_createFile(path);
+         this->perun2.cache.invalidate(path);
          this->perun2.contexts.success->value = s;
 
          if (s) {
@@ -988,6 +1020,7 @@ void C_CreateDirectories_List_Stack::run()
          }
 
          const p_bool s = os_createDirectory(path);
+         this->perun2.cache.invalidate(path);
          this->perun2.contexts.success->value = s;
 
          if (s) {
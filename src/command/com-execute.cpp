@@ -147,6 +147,7 @@ ExecutionResult SimpleExecutor::execute(const p_str& command) const
 ExecutionResult Executor::executeSilently(const p_str& command, const p_str& location) const
 {
    const p_bool success = os_run(command, location, this->perun2);
+   this->perun2.cache.clear();
    this->perun2.contexts.success->value = success;
 
    return success ? ExecutionResult::ER_Good : ExecutionResult::ER_Bad;
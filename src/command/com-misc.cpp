@@ -129,6 +129,7 @@ void C_Run::run()
 
    const p_str loc = this->getLocation();
    const p_bool s = os_run(command, loc, this->perun2);
+   this->perun2.cache.clear();
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -152,6 +153,7 @@ void C_RunWith::run()
    const p_str com = str(base, CHAR_SPACE, os_quoteEmbraced(this->context->trimmed));
    const p_str loc = this->getLocation();
    const p_bool s = os_run(com, loc, this->perun2);
+   this->perun2.cache.clear();
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -178,6 +180,7 @@ void C_RunWithWithString::run()
 
    const p_str loc = this->getLocation();
    const p_bool s = os_run(com, loc, this->perun2);
+   this->perun2.cache.clear();
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -207,6 +210,7 @@ void C_RunWithWith::run()
       const p_str com = str(base, CHAR_SPACE, os_quoteEmbraced(this->context->trimmed));
       const p_str loc = this->getLocation();
       const p_bool s = os_run(com, loc, this->perun2);
+      this->perun2.cache.clear();
       this->perun2.contexts.success->value = s;
 
       if (s) {
@@ -232,6 +236,7 @@ void C_RunWithWith::run()
       const p_str com = comStream.str();
       const p_str loc = this->getLocation();
       const p_bool s = os_run(com, loc, this->perun2);
+      this->perun2.cache.clear();
       this->perun2.contexts.success->value = s;
 
       if (s) {
@@ -254,6 +259,7 @@ void C_RunWithPerun2::run()
    const p_str com = str(this->perun2.postParseData.cmdProcessStartingArgs, os_quoteEmbraced(this->context->trimmed));
    const p_str loc = this->getLocation();
    const p_bool s = os_run(com, loc, this->perun2);
+   this->perun2.cache.clear();
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -278,6 +284,7 @@ void C_RunWithPerun2WithString::run()
 
    const p_str loc = this->getLocation();
    const p_bool s = os_run(com, loc, this->perun2);
+   this->perun2.cache.clear();
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -303,6 +310,7 @@ void C_RunWithPerun2With::run()
       const p_str com = str(this->perun2.postParseData.cmdProcessStartingArgs, os_quoteEmbraced(this->context->trimmed));
       const p_str loc = this->getLocation();
       const p_bool s = os_run(com, loc, this->perun2);
+      this->perun2.cache.clear();
       this->perun2.contexts.success->value = s;
 
       if (s) {
@@ -329,6 +337,7 @@ void C_RunWithPerun2With::run()
       const p_str com = comStream.str();
       const p_str loc = this->getLocation();
       const p_bool s = os_run(com, loc, this->perun2);
+      this->perun2.cache.clear();
       this->perun2.contexts.success->value = s;
 
       if (s) {
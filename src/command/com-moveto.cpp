@@ -63,6 +63,7 @@ void C_MoveTo::run()
    const p_str newPath = str(newLoc, OS_SEPARATOR, fulln);
 
    if (os_exists(newPath)) {
+      this->perun2.cache.invalidate(newPath);
       if (!(forced && !(this->context->v_isdirectory->value && os_isAncestor(oldPath, newPath)) 
             && os_drop(newPath, this->perun2))) 
       {
@@ -73,6 +74,8 @@ void C_MoveTo::run()
    }
 
    const p_bool s = os_moveTo(oldPath, newPath);
+   this->perun2.cache.invalidate(oldPath);
+   this->perun2.cache.invalidate(newPath);
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -132,6 +135,8 @@ void C_MoveTo_Stack::run()
    }
 
    const p_bool s = os_moveTo(oldPath, newPath);
+   this->perun2.cache.invalidate(oldPath);
+   this->perun2.cache.invalidate(newPath);
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -187,6 +192,7 @@ void C_MoveToAs::run()
    p_str newPath = str(newLoc, OS_SEPARATOR, fulln);
 
    if (os_exists(newPath)) {
+      this->perun2.cache.invalidate(newPath);
       if (!(forced && !(this->context->v_isdirectory->value && os_isAncestor(oldPath, newPath))
             && os_drop(newPath, this->perun2))) 
       {
@@ -197,6 +203,8 @@ void C_MoveToAs::run()
    }
 
    const p_bool s = os_moveTo(oldPath, newPath);
+   this->perun2.cache.invalidate(oldPath);
+   this->perun2.cache.invalidate(newPath);
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -275,6 +283,8 @@ void C_MoveToAs_Stack::run()
    }
 
    s = os_moveTo(oldPath, newPath);
+   this->perun2.cache.invalidate(oldPath);
+   this->perun2.cache.invalidate(newPath);
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -154,6 +154,11 @@ void ConditionContext::deleteLast()
    this->units.pop_back();
 }
 
+void ConditionContext::reset()
+{
+   this->units.clear();
+}
+
 void ConditionContext::lockLast()
 {
    if (!this->units.empty()) {
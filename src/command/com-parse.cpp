@@ -22,6 +22,7 @@
 #include "../../include/perun2/command/com-parse-unit.hpp"
 #include "../../include/perun2/command/com-condition.hpp"
 #include "../../include/perun2/datatype/generator/gen-string.hpp"
+#include "../../include/perun2/datatype/generator/gen-prefetch.hpp"
 #include "../../include/perun2/datatype/parse/parse-number.hpp"
 
 
@@ -417,6 +418,11 @@ static p_bool parseIterationLoop(p_comptr& result, const Tokens& left, const Tok
             result = std::make_unique<CS_ListLoop>(g, com, ctx, p2);
          }
          else {
+            if ((p2.flags & FLAG_MAX_PERFORMANCE) && ctx->attribute->has(ATTR_TYPE_DEPENDENT)) {
+               p_defptr unprefetched = std::move(def);
+               def = std::make_unique<gen::DefPrefetch>(unprefetched, ctx.get(), p2);
+            }
+
             result = std::make_unique<CS_DefinitionLoop>(def, com, ctx, p2);
          }
       }
@@ -1193,17 +1199,14 @@ static void makeVarAssignment(p_comptr& result, const Token& token, Perun2Proces
 {
    UserVarsContext* uvc = p2.contexts.getUserVarsContext();
    const p_bool isConstant = !p2.contexts.hasAggregate() && valuePtr->isConstant();
-   p_varptrs<T>* allVarsOfThisType;
-   uvc->userVars.takeVarsPtr(allVarsOfThisType);
-   p_str name = token.toLowerString();
-   allVarsOfThisType->insert(std::make_pair(name, std::make_unique<Variable<T>>(VarType::vt_User)));
+   Variable<T>* var = uvc->userVars.insertVar<T>(token.toLowerString(), VarType::vt_User);
 
-   (*allVarsOfThisType)[name]->isConstant_ = isConstant;
+   var->isConstant_ = isConstant;
    if (isConstant) {
-      (*allVarsOfThisType)[name]->value = valuePtr->getValue();
+      var->value = valuePtr->getValue();
    }
 
-   result = std::make_unique<comm::VarAssignment<T>>(*(*allVarsOfThisType)[name], valuePtr);
+   result = std::make_unique<comm::VarAssignment<T>>(*var, valuePtr);
 }
 
 static p_bool commandVarAssign(p_comptr& result, const Tokens& left, const Tokens& right, Perun2Process& p2)
@@ -62,6 +62,7 @@ void C_RenameTo::run()
    const p_str newPath = str(base, OS_SEPARATOR, n);
 
    if (os_exists(newPath)) {
+      this->perun2.cache.invalidate(newPath);
       if (!(forced && os_drop(newPath, this->perun2))) {
          this->perun2.logger.log(L"Failed to rename ", getCCName(this->context->v_path->value));
          this->perun2.contexts.success->value = false;
@@ -70,6 +71,8 @@ void C_RenameTo::run()
    }
 
    const p_bool s = os_moveTo(this->context->v_path->value, newPath);
+   this->perun2.cache.invalidate(this->context->v_path->value);
+   this->perun2.cache.invalidate(newPath);
    this->perun2.contexts.success->value = s;
 
    if (s) {
@@ -130,6 +133,8 @@ void C_RenameTo_Stack::run()
    }
 
    const p_bool s = os_moveTo(oldPath, newPath);
+   this->perun2.cache.invalidate(oldPath);
+   this->perun2.cache.invalidate(newPath);
    
    if (hasExt) {
       n = os_fullname(newPath);
@@ -23,6 +23,8 @@ namespace perun2::comm
 
 void CS_RawBlock::run()
 {
+   this->context->userVars.reset();
+
    for (p_comptr& cmd : this->commands) {
       if (this->perun2.isNotRunning()) {
          return;
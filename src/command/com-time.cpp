@@ -37,6 +37,7 @@ void C_ReaccessTo::run()
 
    this->perun2.contexts.success->value = this->context->v_exists->value
       && os_setTime(this->context->v_path->value, this->context->v_creation->value, t, this->context->v_modification->value);
+   this->perun2.cache.invalidate(this->context->v_path->value);
 
    if (this->perun2.contexts.success->value) {
       this->perun2.logger.log(L"Reaccess ", getCCName(this->context->v_path->value), L" to ", t.toString());
@@ -65,6 +66,7 @@ void C_RechangeTo::run()
 
    this->perun2.contexts.success->value = this->context->v_exists->value
       && os_setTime(this->context->v_path->value, this->context->v_creation->value, this->context->v_access->value, t);
+   this->perun2.cache.invalidate(this->context->v_path->value);
 
    if (this->perun2.contexts.success->value) {
       this->perun2.logger.log(L"Rechange ", getCCName(this->context->v_path->value), L" to ", t.toString());
@@ -94,6 +96,7 @@ void C_RecreateTo::run()
 
    this->perun2.contexts.success->value = this->context->v_exists->value
       && os_setTime(this->context->v_path->value, t, this->context->v_access->value, this->context->v_modification->value);
+   this->perun2.cache.invalidate(this->context->v_path->value);
 
    if (this->perun2.contexts.success->value) {
       this->perun2.logger.log(L"Recreate ", getCCName(this->context->v_path->value),  L" to ", t.toString());
@@ -122,6 +125,7 @@ void C_RemodifyTo::run()
 
    this->perun2.contexts.success->value = this->context->v_exists->value
       && os_setTime(this->context->v_path->value, this->context->v_creation->value, this->context->v_access->value, t);
+   this->perun2.cache.invalidate(this->context->v_path->value);
 
    if (this->perun2.contexts.success->value) {
       this->perun2.logger.log(L"Remodify ", getCCName(this->context->v_path->value), L" to ", t.toString());
@@ -93,6 +93,16 @@ namespace perun2
       return findVar(tk, result, p2);
    }
 
+   void Contexts::resetParsing()
+   {
+      this->userVarsContexts.clear();
+      this->aggregateContexts.clear();
+      this->indexContexts.clear();
+      this->fileContexts.clear();
+      this->locationContexts.clear();
+      this->locationContexts.push_back(&this->rootLocation);
+   }
+
    void Contexts::addUserVarsContext(UserVarsContext* ctx)
    {
       this->userVarsContexts.push_back(ctx);
@@ -139,6 +149,11 @@ namespace perun2
       this->fileContexts.pop_back();
    }
 
+   void Contexts::setRootLocation(const p_str& location)
+   {
+      this->rootLocation.location->value = location;
+   }
+
    void Contexts::addLocationContext(LocationContext* ctx)
    {
       this->locationContexts.push_back(ctx);
@@ -595,20 +595,16 @@ p_num F_ShiftWeekDay_Number::getValue()
 p_num F_Resemblance::getValue()
 {
    p_str v = this->arg1->getValue();
-   p_str p = this->arg2->getValue();
+   gen::ResemblancePattern pattern(this->arg2->getValue());
 
    gen::prepareForResemblance(v);
-   gen::prepareForResemblance(p);
 
-   return gen::str_resemblance(v, p);
+   return gen::str_resemblance(v, pattern);
 }
 
 
 F_ResemblanceConst::F_ResemblanceConst(p_genptr<p_str>& a1, const p_str& patt) 
-   : Func_1(a1), pattern(patt)
-{ 
-   gen::prepareForResemblance(this->pattern);
-};
+   : Func_1(a1), pattern(patt) { };
 
 
 p_num F_ResemblanceConst::getValue()
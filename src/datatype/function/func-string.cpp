@@ -164,31 +164,49 @@ p_str F_Letters::getValue()
 
 p_str F_Lower::getValue()
 {
-   p_str value = arg1->getValue();
-   if (!value.empty()) {
-      str_toLower(value);
-   }
+   p_str value;
+   this->writeValue(value);
    return value;
 }
 
+void F_Lower::writeValue(p_str& result)
+{
+   arg1->writeValue(result);
+   if (!result.empty()) {
+      str_toLower(result);
+   }
+}
+
 
 p_str F_Trim::getValue()
 {
-   p_str value = arg1->getValue();
-   str_trim(value);
+   p_str value;
+   this->writeValue(value);
    return value;
 }
 
+void F_Trim::writeValue(p_str& result)
+{
+   arg1->writeValue(result);
+   str_trim(result);
+}
+
 
 p_str F_Upper::getValue()
 {
-   p_str value = arg1->getValue();
-   if (!value.empty()) {
-      str_toUpper(value);
-   }
+   p_str value;
+   this->writeValue(value);
    return value;
 }
 
+void F_Upper::writeValue(p_str& result)
+{
+   arg1->writeValue(result);
+   if (!result.empty()) {
+      str_toUpper(result);
+   }
+}
+
 
 p_str F_Repeat::getValue()
 {
@@ -437,15 +455,22 @@ p_str F_LastDef::getValue()
 
 p_str F_Replace::getValue()
 {
-   p_str base = arg1->getValue();
+   p_str base;
+   this->writeValue(base);
+   return base;
+}
+
+void F_Replace::writeValue(p_str& base)
+{
+   arg1->writeValue(base);
    p_size len = base.size();
 
    if (len == 0) {
-      return base;
+      return;
    }
 
-   const p_str v1 = arg2->getValue();
-   const p_str v2 = arg3->getValue();
+   const p_str& v1 = readValue(*arg2, this->buffer1);
+   const p_str& v2 = readValue(*arg3, this->buffer2);
 
    switch (v1.size()) {
       case 0: {
@@ -464,16 +489,7 @@ p_str F_Replace::getValue()
             default: {
                for (p_size i = 0; i < len; i++) {
                   if (base[i] == v1[0]) {
-                     if (i == 0) {
-                        base = str(v2, base.substr(1));
-                     }
-                     else if (i == len - 1) {
-                        return str(base.substr(0, len - 1), v2);
-                     }
-                     else {
-                        base = str(base.substr(0, i), v2, base.substr(i + 1));
-                     }
-
+                     base.replace(i, 1, v2);
                      i += v2.size() - 1;
                      len += v2.size() - 1;
                   }
@@ -504,8 +520,6 @@ p_str F_Replace::getValue()
          break;
       }
    }
-
-   return base;
 }
 
 
@@ -53,6 +53,11 @@ p_bool Xor::getValue()
 InConstTimeList::InConstTimeList(p_genptr<p_tim>& val, const p_tlist& li)
    : value(std::move(val)), list(li) { };
 
+p_bool InConstTimeList::isFoldable() const
+{
+   return this->value->isFoldable();
+}
+
 p_bool InConstTimeList::getValue() 
 {
    const p_tim v = value->getValue();
@@ -25,6 +25,12 @@ DoubleAsteriskPattern::DoubleAsteriskPattern(p_rallptr& def, Perun2Process& p2,
       hasRetreats(retr != 0), retreat(hasRetreats ? os_doubleDotsPrefix(retr) : p_str())
 {   
    minLength = this->getMinLength(pat);
+   this->compileBits(this->startId);
+
+   if (this->bitParallel && this->specialStart && this->startId == 0) {
+      // the leading double asterisk together with its separator can match nothing
+      this->startBits |= static_cast<uint64_t>(1) << 2;
+   }
 };
 
 
@@ -156,4 +162,26 @@ Logic DoubleAsteriskPattern::checkState(const p_size n, const p_size m)
    return ans;
 }
 
+WildcardElement DoubleAsteriskPattern::getElement(const p_size index) const
+{
+   switch (this->pattern[index]) {
+      case WILDCARD_SINGLE_ASTERISK: {
+         return WildcardElement::we_NonSeparatorChars;
+      }
+      case WILDCARD_DOUBLE_ASTERISK: {
+         return WildcardElement::we_AnyChars;
+      }
+      default: {
+         return WildcardElement::we_Literal;
+      }
+   }
+}
+
+p_bool DoubleAsteriskPattern::canJumpOver(const p_size index) const
+{
+   return this->pattern[index] == WILDCARD_DOUBLE_ASTERISK
+      && index >= 1 && this->pattern[index - 1] == OS_SEPARATOR
+      && index + 1 < this->patternLength && this->pattern[index + 1] == OS_SEPARATOR;
+}
+
 }
@@ -70,6 +70,11 @@ p_num Modulo::getValue()
 TimeMember::TimeMember(p_genptr<p_tim>& tim, const Period::PeriodUnit pu) 
    : time(std::move(tim)), unit(pu) { };
 
+p_bool TimeMember::isFoldable() const
+{
+   return this->time->isFoldable();
+}
+
 p_num TimeMember::getValue() 
 {
    const p_tim t = this->time->getValue();
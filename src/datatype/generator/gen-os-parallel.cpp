@@ -0,0 +1,330 @@
+/*
+    This file is part of Perun2.
+    Perun2 is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    Perun2 is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with Perun2. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef UNICODE
+#define UNICODE
+#endif
+
+#ifndef _UNICODE
+#define _UNICODE
+#endif
+
+#include "../../../include/perun2/datatype/generator/gen-os-parallel.hpp"
+#include "../../../include/perun2/perun2.hpp"
+#include "../../../include/perun2/os/os.hpp"
+#include <chrono>
+
+
+namespace perun2::gen
+{
+
+ParallelWalker::ParallelWalker(Perun2Process& p2)
+   : noOmit(p2.flags & FLAG_NOOMIT), perun2(p2),
+     pendingDirectories(0), activeThreads(0), stopped(true) { };
+
+ParallelWalker::~ParallelWalker()
+{
+   this->stop(this->owner);
+
+   {
+      std::lock_guard<std::mutex> lock(this->walkMutex);
+      this->closed = true;
+   }
+
+   this->walkCondition.notify_all();
+
+   for (std::thread& thread : this->threads) {
+      if (thread.joinable()) {
+         thread.join();
+      }
+   }
+}
+
+p_bool ParallelWalker::isFree() const
+{
+   return this->owner == nullptr;
+}
+
+void ParallelWalker::start(const void* owner, const OsElement el, const p_str& root)
+{
+   this->stop(this->owner);
+
+   if (this->threads.empty()) {
+      p_size count = static_cast<p_size>(std::thread::hardware_concurrency());
+      if (count < PARALLEL_WALKER_MIN_THREADS) {
+         count = PARALLEL_WALKER_MIN_THREADS;
+      }
+      else if (count > PARALLEL_WALKER_MAX_THREADS) {
+         count = PARALLEL_WALKER_MAX_THREADS;
+      }
+
+      for (p_size i = 0; i < count; i++) {
+         this->queues.emplace_back(std::make_unique<WalkerQueue>());
+      }
+
+      for (p_size i = 0; i < count; i++) {
+         this->threads.emplace_back(&ParallelWalker::run, this, i);
+      }
+   }
+
+   this->owner = owner;
+   this->element = el;
+   this->rootPath = root;
+   this->stopped = false;
+   this->activeThreads = this->threads.size();
+   this->pendingDirectories = 1;
+
+   {
+      std::lock_guard<std::mutex> lock(this->entriesMutex);
+      this->finished = false;
+   }
+
+   // the root is represented by an empty relative path
+   this->queues[0]->directories.emplace_back();
+
+   {
+      std::lock_guard<std::mutex> lock(this->walkMutex);
+      this->walkId++;
+   }
+
+   this->walkCondition.notify_all();
+}
+
+void ParallelWalker::stop(const void* owner)
+{
+   if (owner == nullptr || owner != this->owner) {
+      return;
+   }
+
+   this->stopped = true;
+   this->idleCondition.notify_all();
+
+   {
+      std::lock_guard<std::mutex> lock(this->entriesMutex);
+      this->entriesNotFull.notify_all();
+      this->entriesNotEmpty.notify_all();
+   }
+
+   {
+      std::unique_lock<std::mutex> lock(this->walkMutex);
+      this->walkCondition.wait(lock, [this] { 
+         return this->activeThreads == 0; 
+      });
+   }
+
+   for (std::unique_ptr<WalkerQueue>& queue : this->queues) {
+      queue->directories.clear();
+   }
+
+   this->entries.clear();
+   this->finished = true;
+   this->owner = nullptr;
+}
+
+p_bool ParallelWalker::next(p_str& path, p_fdata& data)
+{
+   std::unique_lock<std::mutex> lock(this->entriesMutex);
+   this->entriesNotEmpty.wait(lock, [this] { 
+      return !this->entries.empty() || this->finished || this->stopped; 
+   });
+
+   if (this->entries.empty()) {
+      return false;
+   }
+
+   WalkerEntry& entry = this->entries.front();
+   path = std::move(entry.path);
+   data = entry.data;
+   this->entries.pop_front();
+   lock.unlock();
+
+   this->entriesNotFull.notify_one();
+   return true;
+}
+
+// a thread of the pool takes part in every walk until the process ends
+void ParallelWalker::run(const p_size id)
+{
+   p_size lastWalk = 0;
+
+   while (true) {
+      {
+         std::unique_lock<std::mutex> lock(this->walkMutex);
+         this->walkCondition.wait(lock, [this, lastWalk] { 
+            return this->closed || this->walkId != lastWalk; 
+         });
+
+         if (this->closed) {
+            return;
+         }
+
+         lastWalk = this->walkId;
+      }
+
+      this->work(id);
+   }
+}
+
+void ParallelWalker::work(const p_size id)
+{
+   p_str directory;
+
+   while (!this->stopped) {
+      if (this->takeDirectory(id, directory)) {
+         this->readDirectory(id, directory);
+
+         if (--this->pendingDirectories == 0) {
+            this->idleCondition.notify_all();
+         }
+      }
+      else if (this->pendingDirectories == 0) {
+         break;
+      }
+      else {
+         // other threads are still reading
+         // some of them may soon find subdirectories to share
+         std::unique_lock<std::mutex> lock(this->idleMutex);
+         this->idleCondition.wait_for(lock, std::chrono::milliseconds(PARALLEL_WALKER_IDLE_MS));
+      }
+   }
+
+   if (--this->activeThreads == 0) {
+      {
+         std::lock_guard<std::mutex> lock(this->entriesMutex);
+         this->finished = true;
+         this->entriesNotEmpty.notify_all();
+      }
+
+      std::lock_guard<std::mutex> lock(this->walkMutex);
+      this->walkCondition.notify_all();
+   }
+}
+
+void ParallelWalker::readDirectory(const p_size id, const p_str& directory)
+{
+   p_entry handle;
+   p_fdata data;
+   const p_str pattern = str(this->rootPath, OS_SEPARATOR, directory, CHAR_ASTERISK);
+
+   if (!os_hasFirstFile(pattern, handle, data)) {
+      return;
+   }
+
+   do {
+      if (this->stopped || this->perun2.isNotRunning()) {
+         this->stopped = true;
+         break;
+      }
+
+      const p_str name = data.cFileName;
+
+      if (os_isBrowsePath(name)) {
+         continue;
+      }
+
+      const p_bool isDirectory = os_isDirectory(data);
+
+      if (isDirectory) {
+         this->addDirectory(id, str(directory, name, OS_SEPARATOR));
+      }
+
+      if (this->accepts(isDirectory, name) && !this->addEntry(str(directory, name), data)) {
+         break;
+      }
+   }
+   while (os_hasNextFile(handle, data));
+
+   os_closeEntry(handle);
+}
+
+p_bool ParallelWalker::takeDirectory(const p_size id, p_str& result)
+{
+   // the own queue is used like a stack, so the thread goes deeper into the recent directory
+   {
+      WalkerQueue& own = *this->queues[id];
+      std::lock_guard<std::mutex> lock(own.mutex);
+
+      if (!own.directories.empty()) {
+         result = std::move(own.directories.back());
+         own.directories.pop_back();
+         return true;
+      }
+   }
+
+   // and other queues are robbed from the opposite side
+   // the oldest directories are usually the closest to the root and have the biggest subtrees
+   const p_size count = this->queues.size();
+
+   for (p_size i = 1; i < count; i++) {
+      WalkerQueue& other = *this->queues[(id + i) % count];
+      std::lock_guard<std::mutex> lock(other.mutex);
+
+      if (!other.directories.empty()) {
+         result = std::move(other.directories.front());
+         other.directories.pop_front();
+         return true;
+      }
+   }
+
+   return false;
+}
+
+void ParallelWalker::addDirectory(const p_size id, const p_str& directory)
+{
+   this->pendingDirectories++;
+
+   {
+      WalkerQueue& own = *this->queues[id];
+      std::lock_guard<std::mutex> lock(own.mutex);
+      own.directories.emplace_back(directory);
+   }
+
+   this->idleCondition.notify_one();
+}
+
+p_bool ParallelWalker::addEntry(const p_str& path, const p_fdata& data)
+{
+   std::unique_lock<std::mutex> lock(this->entriesMutex);
+   this->entriesNotFull.wait(lock, [this] { 
+      return this->entries.size() < PARALLEL_WALKER_QUEUE_CAPACITY || this->stopped; 
+   });
+
+   if (this->stopped) {
+      return false;
+   }
+
+   this->entries.push_back({ path, data });
+   lock.unlock();
+
+   this->entriesNotEmpty.notify_one();
+   return true;
+}
+
+p_bool ParallelWalker::accepts(const p_bool isDirectory, const p_str& name) const
+{
+   switch (this->element) {
+      case OsElement::oe_RecursiveFiles: {
+         return !isDirectory && (this->noOmit || !os_isPerun2Extension(name));
+      }
+      case OsElement::oe_RecursiveDirectories: {
+         return isDirectory;
+      }
+      default: {
+         return isDirectory || this->noOmit || !os_isPerun2Extension(name);
+      }
+   }
+}
+
+}
@@ -84,12 +84,35 @@ p_bool OsDefinitionPlain::isExceptional(const p_str& patt)
    return true;
 }
 
+OsDefinitionRecursive::OsDefinitionRecursive(P_GEN_OS_ARGS, const OsElement el)
+   : OsDefinition(P_GEN_OS_ARGS_2), element(el)
+{
+   if (this->flags & FLAG_PARALLEL) {
+      this->walker = &p2.walker;
+   }
+};
+
+OsDefinitionRecursive::~OsDefinitionRecursive()
+{
+   if (this->walker != nullptr) {
+      this->walker->stop(this);
+   }
+}
+
 void OsDefinitionRecursive::reset()
 {
    if (!first) {
       first = true;
-      paths.clear();
-      bases.clear();
+
+      if (this->walking) {
+         this->walker->stop(this);
+         return;
+      }
+
+      path.clear();
+      base.clear();
+      pathLengths.clear();
+      baseLengths.clear();
       const p_size len = handles.size();
       if (len != 0) {
          for (p_size i = 0; i < len; i++) {
@@ -102,10 +125,51 @@ void OsDefinitionRecursive::reset()
 
 p_bool OsDefinitionRecursive::setAction(p_daptr& act)
 {
+   // actions rely on the order of entering and leaving directories
+   // so the traversal has to be sequential
+   this->walker = nullptr;
    this->action = std::move(act);
    return true;
 }
 
+p_bool OsDefinitionRecursive::usesWalker()
+{
+   if (first) {
+      this->walking = this->walker != nullptr && this->walker->isFree();
+   }
+
+   return this->walking;
+}
+
+p_bool OsDefinitionRecursive::parallelHasNext()
+{
+   if (first) {
+      this->baseLocation = os_trim(location->getValue());
+
+      if (!os_directoryExists(this->baseLocation)) {
+         return false;
+      }
+
+      first = false;
+      index.setToZero();
+      this->context.index->value = index;
+      this->walker->start(this, this->element, this->baseLocation);
+   }
+
+   if (this->perun2.isRunning() && this->walker->next(value, data)) {
+      this->context.index->value = index;
+      index++;
+
+      P_OS_GEN_VALUE_ALTERATION;
+
+      this->context.loadData(value, data);
+      return true;
+   }
+
+   reset();
+   return false;
+}
+
 p_bool All::hasNext()
 {
    if (first) {
@@ -289,8 +353,53 @@ p_bool Directories::hasNext()
 }
 
 
+void OsDefinitionRecursive::enterDirectory(const p_str& name)
+{
+   this->pathLengths.push_back(this->path.size());
+   this->path += OS_SEPARATOR;
+   this->path += name;
+
+   this->baseLengths.push_back(this->base.size());
+   this->base += name;
+   this->base += OS_SEPARATOR;
+}
+
+p_bool OsDefinitionRecursive::leaveDirectory()
+{
+   this->path.resize(this->pathLengths.back());
+   this->pathLengths.pop_back();
+
+   if (this->pathLengths.empty()) {
+      return false;
+   }
+
+   this->base.resize(this->baseLengths.back());
+   this->baseLengths.pop_back();
+   return true;
+}
+
+p_bool OsDefinitionRecursive::openDirectory()
+{
+   // the pattern is appended only for the time of the query
+   const p_size length = this->path.size();
+   this->path += gen::os::DEFAULT_PATTERN;
+   this->handles.emplace_back();
+   const p_bool opened = os_hasFirstFile(this->path, this->handles.back(), this->data);
+   this->path.resize(length);
+
+   if (!opened) {
+      this->handles.pop_back();
+   }
+
+   return opened;
+}
+
 p_bool RecursiveFiles::hasNext()
 {
+   if (this->usesWalker()) {
+      return this->parallelHasNext();
+   }
+
    if (first) {
       if (this->action) {
          this->action->reset();
@@ -298,7 +407,8 @@ p_bool RecursiveFiles::hasNext()
       }
 
       this->baseLocation = os_trim(location->getValue());
-      this->paths.emplace_back(this->baseLocation);
+      this->path = this->baseLocation;
+      this->pathLengths.push_back(0);
       goDeeper = true;
       first = false;
       index.setToZero();
@@ -308,24 +418,17 @@ p_bool RecursiveFiles::hasNext()
    while (this->perun2.isRunning()) {
       if (goDeeper) {
          goDeeper = false;
-         if (os_directoryExists(paths.back())) {
-            const p_str path = str(paths.back(), gen::os::DEFAULT_PATTERN);
-            handles.emplace_back();
-            
-            if (!os_hasFirstFile(path, handles.back(), data)) {
-               handles.pop_back();
-               paths.pop_back();
-
+         // subdirectories come from the enumeration itself
+         // so only the base location has to be checked for existence
+         if (pathLengths.size() > 1 || os_directoryExists(path)) {
+            if (!this->openDirectory()) {
                if (this->action) {
                   this->action->onDirectoryExit();
                }
             
-               if (paths.empty()) {
+               if (!this->leaveDirectory()) {
                   break;
                }
-               else {
-                  bases.pop_back();
-               }
             }
             else if (!os_isDirectory(data)) {
                const p_str& v = data.cFileName;
@@ -343,18 +446,13 @@ p_bool RecursiveFiles::hasNext()
             }
          }
          else {
-            paths.pop_back();
-
             if (this->action) {
                this->action->onDirectoryExit();
             }
 
-            if (paths.empty()) {
+            if (!this->leaveDirectory()) {
                break;
             }
-            else {
-               bases.pop_back();
-            }
          }
       }
       else {
@@ -363,14 +461,7 @@ p_bool RecursiveFiles::hasNext()
 
             if (!os_isBrowsePath(v)) {
                if (os_isDirectory(data)) {
-                  paths.emplace_back(str(paths.back(), OS_SEPARATOR, v));
-
-                  if (this->bases.empty()) {
-                     bases.emplace_back(str(v, OS_SEPARATOR));
-                  }
-                  else {
-                     bases.emplace_back(str(bases.back(), v, OS_SEPARATOR));
-                  }
+                  this->enterDirectory(v);
 
                   if (this->action) {
                      this->action->onDirectoryEnter();
@@ -379,7 +470,8 @@ p_bool RecursiveFiles::hasNext()
                   goDeeper = true;
                }
                else if ((this->flags & FLAG_NOOMIT) || !os_isPerun2Extension(v)) {
-                  value = this->bases.empty() ? v : str(bases.back(), v);
+                  value = base;
+                  value += v;
                   this->context.index->value = index;
                   index++;
 
@@ -397,14 +489,10 @@ p_bool RecursiveFiles::hasNext()
 
             os_closeEntry(handles.back());
             handles.pop_back();
-            paths.pop_back();
 
-            if (paths.empty()) {
+            if (!this->leaveDirectory()) {
                break;
             }
-            else {
-               bases.pop_back();
-            }
          }
       }
    }
@@ -415,13 +503,18 @@ p_bool RecursiveFiles::hasNext()
 
 p_bool RecursiveDirectories::hasNext()
 {
+   if (this->usesWalker()) {
+      return this->parallelHasNext();
+   }
+
    if (first) {
       if (this->action) {
          this->action->reset();
       }
 
       this->baseLocation = os_trim(location->getValue());
-      this->paths.emplace_back(this->baseLocation);
+      this->path = this->baseLocation;
+      this->pathLengths.push_back(0);
       goDeeper = true;
       first = false;
       index.setToZero();
@@ -431,20 +524,13 @@ p_bool RecursiveDirectories::hasNext()
    while (this->perun2.isRunning()) {
       if (goDeeper) {
          goDeeper = false;
-         if (os_directoryExists(paths.back())) {
-            const p_str path = str(paths.back(), gen::os::DEFAULT_PATTERN);
-            handles.emplace_back();
-
-            if (!os_hasFirstFile(path, handles.back(), data)) {
-               handles.pop_back();
-               paths.pop_back();
-
-               if (paths.empty()) {
+         // subdirectories come from the enumeration itself
+         // so only the base location has to be checked for existence
+         if (pathLengths.size() > 1 || os_directoryExists(path)) {
+            if (!this->openDirectory()) {
+               if (!this->leaveDirectory()) {
                   break;
                }
-               else {
-                  bases.pop_back();
-               }
             }
             else {
                if (this->action) {
@@ -453,18 +539,13 @@ p_bool RecursiveDirectories::hasNext()
             }
          }
          else {
-            paths.pop_back();
-
             if (this->action) {
                this->action->onDirectoryExit();
             }
 
-            if (paths.empty()) {
+            if (!this->leaveDirectory()) {
                break;
             }
-            else {
-               bases.pop_back();
-            }
          }
       }
       else {
@@ -473,16 +554,9 @@ p_bool RecursiveDirectories::hasNext()
 
             if (!os_isBrowsePath(v) && os_isDirectory(data))
             {
-               const p_bool isBase = this->bases.empty();
-               value = isBase ? v : str(bases.back(), v);
-               paths.emplace_back(str(paths.back(), OS_SEPARATOR, v));
-
-               if (isBase) {
-                  bases.emplace_back(str(v, OS_SEPARATOR));
-               }
-               else {
-                  bases.emplace_back(str(bases.back(), v, OS_SEPARATOR));
-               }
+               value = base;
+               value += v;
+               this->enterDirectory(v);
                
                goDeeper = true;
                this->context.index->value = index;
@@ -501,14 +575,10 @@ p_bool RecursiveDirectories::hasNext()
 
             os_closeEntry(handles.back());
             handles.pop_back();
-            paths.pop_back();
 
-            if (paths.empty()) {
+            if (!this->leaveDirectory()) {
                break;
             }
-            else {
-               bases.pop_back();
-            }
          }
       }
    }
@@ -519,13 +589,18 @@ p_bool RecursiveDirectories::hasNext()
 
 p_bool RecursiveAll::hasNext()
 {
+   if (this->usesWalker()) {
+      return this->parallelHasNext();
+   }
+
    if (first) {
       if (this->action) {
          this->action->reset();
       }
 
       this->baseLocation = os_trim(location->getValue());
-      this->paths.emplace_back(this->baseLocation);
+      this->path = this->baseLocation;
+      this->pathLengths.push_back(0);
       goDeeper = true;
       first = false;
       index.setToZero();
@@ -535,20 +610,13 @@ p_bool RecursiveAll::hasNext()
    while (this->perun2.isRunning()) {
       if (goDeeper) {
          goDeeper = false;
-         if (os_directoryExists(paths.back())) {
-            const p_str path = str(paths.back(), gen::os::DEFAULT_PATTERN);
-            handles.emplace_back();
-            
-            if (!os_hasFirstFile(path, handles.back(), data)) {
-               handles.pop_back();
-               paths.pop_back();
-
-               if (paths.empty()) {
+         // subdirectories come from the enumeration itself
+         // so only the base location has to be checked for existence
+         if (pathLengths.size() > 1 || os_directoryExists(path)) {
+            if (!this->openDirectory()) {
+               if (!this->leaveDirectory()) {
                   break;
                }
-               else {
-                  bases.pop_back();
-               }
             }
             else {
                if (this->action) {
@@ -557,18 +625,13 @@ p_bool RecursiveAll::hasNext()
             }
          }
          else {
-            paths.pop_back();
-
             if (this->action) {
                this->action->onDirectoryExit();
             }
 
-            if (paths.empty()) {
+            if (!this->leaveDirectory()) {
                break;
             }
-            else {
-               bases.pop_back();
-            }
          }
       }
       else {
@@ -582,17 +645,9 @@ p_bool RecursiveAll::hasNext()
                      this->prevFile = false;
                   }
 
-                  const p_bool isBase = this->bases.empty();
-
-                  value = isBase ? v : str(bases.back(), v);
-                  paths.emplace_back(str(paths.back(), OS_SEPARATOR, v));
-
-                  if (isBase) {
-                     bases.emplace_back(str(v, OS_SEPARATOR));
-                  }
-                  else {
-                     bases.emplace_back(str(bases.back(), v, OS_SEPARATOR));
-                  }
+                  value = base;
+                  value += v;
+                  this->enterDirectory(v);
 
                   goDeeper = true;
                   this->context.index->value = index;
@@ -609,8 +664,8 @@ p_bool RecursiveAll::hasNext()
                      this->prevFile = true;
                   }
 
-                  const p_bool isBase = this->bases.empty();
-                  value = isBase ? v : str(bases.back(), v);
+                  value = base;
+                  value += v;
                   this->context.index->value = index;
                   index++;
 
@@ -628,14 +683,10 @@ p_bool RecursiveAll::hasNext()
 
             os_closeEntry(handles.back());
             handles.pop_back();
-            paths.pop_back();
 
-            if (paths.empty()) {
+            if (!this->leaveDirectory()) {
                break;
             }
-            else {
-               bases.pop_back();
-            }
          }
       }
    }
@@ -21,6 +21,11 @@ namespace perun2::gen
 PeriodUnit::PeriodUnit(p_genptr<p_num>& val, Period::PeriodUnit un)
    : value(std::move(val)), unit(un) { };
 
+p_bool PeriodUnit::isFoldable() const
+{
+   return this->value->isFoldable();
+}
+
 p_per PeriodUnit::getValue()
 {
    const p_num num = this->value->getValue();
@@ -51,6 +56,11 @@ p_per PeriodSubtraction::getValue()
 TimeDifference::TimeDifference(p_genptr<p_tim>& val1, p_genptr<p_tim>& val2)
    : value1(std::move(val1)), value2(std::move(val2)) { };
 
+p_bool TimeDifference::isFoldable() const
+{
+   return this->value1->isFoldable() && this->value2->isFoldable();
+}
+
 p_per TimeDifference::getValue()
 {
    return this->value1->getValue() - this->value2->getValue();
@@ -59,6 +69,11 @@ p_per TimeDifference::getValue()
 NegatedPeriod::NegatedPeriod(p_genptr<p_per>& val) 
    : value(std::move(val)) { };
 
+p_bool NegatedPeriod::isFoldable() const
+{
+   return this->value->isFoldable();
+}
+
 p_per NegatedPeriod::getValue()
 {
    return -(this->value->getValue());
@@ -0,0 +1,185 @@
+/*
+    This file is part of Perun2.
+    Perun2 is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    Perun2 is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with Perun2. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "../../../include/perun2/datatype/generator/gen-prefetch.hpp"
+#include "../../../include/perun2/perun2.hpp"
+#include "../../../include/perun2/os/os.hpp"
+#include <algorithm>
+
+
+namespace perun2::gen
+{
+
+AttributePrefetcher::AttributePrefetcher(Perun2Process& p2)
+   : perun2(p2) { };
+
+AttributePrefetcher::~AttributePrefetcher()
+{
+   {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      this->stopped = true;
+      this->pending.clear();
+   }
+
+   this->condition.notify_all();
+
+   for (std::thread& thread : this->threads) {
+      if (thread.joinable()) {
+         thread.join();
+      }
+   }
+}
+
+void AttributePrefetcher::add(const void* owner, const p_str& location, const p_str& value)
+{
+   {
+      std::lock_guard<std::mutex> lock(this->mutex);
+
+      if (this->threads.empty()) {
+         for (p_size i = 0; i < PREFETCH_THREADS; i++) {
+            this->threads.emplace_back(&AttributePrefetcher::work, this);
+         }
+      }
+
+      this->pending.push_back({ owner, location, value });
+   }
+
+   this->condition.notify_one();
+}
+
+void AttributePrefetcher::cancel(const void* owner)
+{
+   std::lock_guard<std::mutex> lock(this->mutex);
+
+   this->pending.erase(std::remove_if(this->pending.begin(), this->pending.end(),
+      [owner](const PrefetchTask& task) { return task.owner == owner; }),
+      this->pending.end());
+}
+
+void AttributePrefetcher::work()
+{
+   while (true) {
+      PrefetchTask next;
+
+      {
+         std::unique_lock<std::mutex> lock(this->mutex);
+         this->condition.wait(lock, [this] { 
+            return !this->pending.empty() || this->stopped; 
+         });
+
+         if (this->stopped) {
+            return;
+         }
+
+         next = std::move(this->pending.front());
+         this->pending.pop_front();
+      }
+
+      if (this->perun2.isNotRunning()) {
+         continue;
+      }
+
+      // the same steps as in os_loadAttributes
+      const p_str trimmed = os_trim(next.value);
+
+      if (!os_isInvalid(trimmed)) {
+         const p_str path = os_leftJoin(next.location, trimmed);
+
+         if (!path.empty() && os_isAbsolute(path)) {
+            os_prefetchAttributes(path, this->perun2.cache);
+         }
+      }
+   }
+}
+
+
+DefPrefetch::DefPrefetch(p_defptr& def, FileContext* ctx, Perun2Process& p2)
+   : definition(std::move(def)), context(ctx), perun2(p2), 
+     locationContext(*p2.contexts.getLocationContext()), prefetcher(p2.prefetcher) { };
+
+p_bool DefPrefetch::hasNext()
+{
+   if (this->first) {
+      this->first = false;
+      this->exhausted = false;
+      this->prefetching = this->context->attribute->has(ATTR_TYPE_DEPENDENT);
+      this->window = 2;
+   }
+
+   if (!this->prefetching) {
+      if (this->definition->hasNext()) {
+         this->value = this->definition->getValue();
+         return true;
+      }
+
+      this->exhausted = true;
+      this->reset();
+      return false;
+   }
+
+   const p_str& location = this->locationContext.location->value;
+
+   while (!this->exhausted && this->values.size() < this->window) {
+      if (this->perun2.isNotRunning()) {
+         break;
+      }
+
+      if (this->definition->hasNext()) {
+         this->values.emplace_back(this->definition->getValue());
+         this->prefetcher.add(this, location, this->values.back());
+      }
+      else {
+         this->exhausted = true;
+      }
+   }
+
+   if (this->values.empty() || this->perun2.isNotRunning()) {
+      this->reset();
+      return false;
+   }
+
+   if (this->window < PREFETCH_WINDOW) {
+      this->window++;
+   }
+
+   this->value = std::move(this->values.front());
+   this->values.pop_front();
+   return true;
+}
+
+void DefPrefetch::reset()
+{
+   if (!this->first) {
+      this->first = true;
+      this->prefetcher.cancel(this);
+      this->values.clear();
+
+      if (!this->exhausted) {
+         this->definition->reset();
+      }
+   }
+}
+
+FileContext* DefPrefetch::getFileContext()
+{
+   return this->definition->getFileContext();
+}
+
+p_bool DefPrefetch::setAction(p_daptr& act)
+{
+   return this->definition->setAction(act);
+}
+
+}
@@ -39,30 +39,77 @@ ConcatString_6::ConcatString_6(p_genptr<p_str>& v1, p_genptr<p_str>& v2, p_genpt
 
 p_str ConcatString_2::getValue()
 {
-   return str(this->value1->getValue(), this->value2->getValue());
+   p_str result;
+   this->writeValue(result);
+   return result;
+};
+
+void ConcatString_2::writeValue(p_str& result)
+{
+   this->value1->writeValue(result);
+   result += readValue(*this->value2, this->buffer);
 };
 
 p_str ConcatString_3::getValue()
 {
-   return str(this->value1->getValue(), this->value2->getValue(), this->value3->getValue());
+   p_str result;
+   this->writeValue(result);
+   return result;
+};
+
+void ConcatString_3::writeValue(p_str& result)
+{
+   this->value1->writeValue(result);
+   result += readValue(*this->value2, this->buffer);
+   result += readValue(*this->value3, this->buffer);
 };
 
 p_str ConcatString_4::getValue()
 {
-   return str(this->value1->getValue(), this->value2->getValue(), this->value3->getValue(),
-              this->value4->getValue());
+   p_str result;
+   this->writeValue(result);
+   return result;
+};
+
+void ConcatString_4::writeValue(p_str& result)
+{
+   this->value1->writeValue(result);
+   result += readValue(*this->value2, this->buffer);
+   result += readValue(*this->value3, this->buffer);
+   result += readValue(*this->value4, this->buffer);
 };
 
 p_str ConcatString_5::getValue()
 {
-   return str(this->value1->getValue(), this->value2->getValue(), this->value3->getValue(),
-              this->value4->getValue(), this->value5->getValue());
+   p_str result;
+   this->writeValue(result);
+   return result;
+};
+
+void ConcatString_5::writeValue(p_str& result)
+{
+   this->value1->writeValue(result);
+   result += readValue(*this->value2, this->buffer);
+   result += readValue(*this->value3, this->buffer);
+   result += readValue(*this->value4, this->buffer);
+   result += readValue(*this->value5, this->buffer);
 };
 
 p_str ConcatString_6::getValue()
 {
-   return str(this->value1->getValue(), this->value2->getValue(), this->value3->getValue(),
-              this->value4->getValue(), this->value5->getValue(), this->value6->getValue());
+   p_str result;
+   this->writeValue(result);
+   return result;
+};
+
+void ConcatString_6::writeValue(p_str& result)
+{
+   this->value1->writeValue(result);
+   result += readValue(*this->value2, this->buffer);
+   result += readValue(*this->value3, this->buffer);
+   result += readValue(*this->value4, this->buffer);
+   result += readValue(*this->value5, this->buffer);
+   result += readValue(*this->value6, this->buffer);
 };
 
 
@@ -73,13 +120,18 @@ ConcatString_Multi::ConcatString_Multi(std::vector<p_genptr<p_str>>& val)
 
 p_str ConcatString_Multi::getValue()
 {
-   p_stream ss;
+   p_str result;
+   this->writeValue(result);
+   return result;
+}
+
+void ConcatString_Multi::writeValue(p_str& result)
+{
+   result.clear();
 
    for (const p_genptr<p_str>& val : this->values) {
-      ss << val->getValue();
+      result += readValue(*val, this->buffer);
    }
-
-   return ss.str();
 }
 
 p_str StringBinary::getValue()
@@ -89,6 +141,16 @@ p_str StringBinary::getValue()
       : p_str();
 }
 
+void StringBinary::writeValue(p_str& result)
+{
+   if (condition->getValue()) {
+      value->writeValue(result);
+   }
+   else {
+      result.clear();
+   }
+}
+
 LocationReference::LocationReference(Perun2Process& p2)
    : context(*p2.contexts.getLocationContext()) { };
 
@@ -126,6 +188,12 @@ p_str RetreatedPath::getValue()
    return v;
 }
 
+void RetreatedPath::writeValue(p_str& result)
+{
+   this->value->writeValue(result);
+   os_retreatPath(result, this->reatreats);
+}
+
 p_str CharAtIndex::getValue()
 {
    const p_str v = value->getValue();
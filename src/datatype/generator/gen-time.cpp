@@ -24,6 +24,11 @@ namespace perun2::gen
 IncreasedTime::IncreasedTime (p_genptr<p_tim>& tim, p_genptr<p_per>& per)
    : time(std::move(tim)), period(std::move(per)) { }
 
+p_bool IncreasedTime::isFoldable() const
+{
+   return this->time->isFoldable() && this->period->isFoldable();
+}
+
 p_tim IncreasedTime::getValue()
 {
    p_tim t = this->time->getValue();
@@ -34,6 +39,11 @@ p_tim IncreasedTime::getValue()
 DecreasedTime::DecreasedTime(p_genptr<p_tim>& tim, p_genptr<p_per>& per)
    : time(std::move(tim)), period(std::move(per)) {};
 
+p_bool DecreasedTime::isFoldable() const
+{
+   return this->time->isFoldable() && this->period->isFoldable();
+}
+
 p_tim DecreasedTime::getValue()
 {
    p_tim t = this->time->getValue();
@@ -23,12 +23,12 @@
 namespace perun2::parse
 {
 
-p_bool parse(Perun2Process& p2, const Tokens& tks, p_genptr<p_bool>& result)
+static p_bool parseGenerator(Perun2Process& p2, const Tokens& tks, p_genptr<p_bool>& result)
 {
    return parseBool(result, tks, p2);
 }
 
-p_bool parse(Perun2Process& p2, const Tokens& tks, p_genptr<p_num>& result)
+static p_bool parseGenerator(Perun2Process& p2, const Tokens& tks, p_genptr<p_num>& result)
 {
    // cast from "bool" to "Number"
    p_genptr<p_bool> boo;
@@ -40,7 +40,7 @@ p_bool parse(Perun2Process& p2, const Tokens& tks, p_genptr<p_num>& result)
    return parseNumber(result, tks, p2);
 }
 
-p_bool parse(Perun2Process& p2, const Tokens& tks, p_genptr<p_str>& result)
+static p_bool parseGenerator(Perun2Process& p2, const Tokens& tks, p_genptr<p_str>& result)
 {
    // cast from "bool" to "string"
    p_genptr<p_bool> boo;
@@ -73,7 +73,7 @@ p_bool parse(Perun2Process& p2, const Tokens& tks, p_genptr<p_str>& result)
    return parseString(result, tks, p2);
 }
 
-p_bool parse(Perun2Process& p2, const Tokens& tks, p_genptr<p_nlist>& result)
+static p_bool parseGenerator(Perun2Process& p2, const Tokens& tks, p_genptr<p_nlist>& result)
 {
    // cast from "bool" to "numList"
    p_genptr<p_bool> boo;
@@ -92,7 +92,7 @@ p_bool parse(Perun2Process& p2, const Tokens& tks, p_genptr<p_nlist>& result)
    return parseNumList(result, tks, p2);
 }
 
-p_bool parse(Perun2Process& p2, const Tokens& tks, p_genptr<p_tlist>& result)
+static p_bool parseGenerator(Perun2Process& p2, const Tokens& tks, p_genptr<p_tlist>& result)
 {
    // cast from "Time" to "timList"
    p_genptr<p_tim> tim;
@@ -104,7 +104,7 @@ p_bool parse(Perun2Process& p2, const Tokens& tks, p_genptr<p_tlist>& result)
    return parseTimList(result, tks, p2);
 }
 
-p_bool parse(Perun2Process& p2, const Tokens& tks, p_genptr<p_list>& result)
+static p_bool parseGenerator(Perun2Process& p2, const Tokens& tks, p_genptr<p_list>& result)
 {
    // cast from "bool" to "list"
    p_genptr<p_bool> boo;
@@ -165,16 +165,74 @@ p_bool parse(Perun2Process& p2, const Tokens& tks, p_genptr<p_list>& result)
    return parseList(result, tks, p2);
 }
 
-p_bool parse(Perun2Process& p2, const Tokens& tks, p_genptr<p_tim>& result)
+static p_bool parseGenerator(Perun2Process& p2, const Tokens& tks, p_genptr<p_tim>& result)
 {
    return parseTime(result, tks, p2);
 }
 
-p_bool parse(Perun2Process& p2, const Tokens& tks, p_genptr<p_per>& result)
+static p_bool parseGenerator(Perun2Process& p2, const Tokens& tks, p_genptr<p_per>& result)
 {
    return parsePeriod(result, tks, p2);
 }
 
+// a subtree built only of literals and stable special constants is replaced by one constant
+// user variables are never folded, as a loop can change them after they are read
+// parsers call each other recursively, so constant parts are folded from the bottom up
+// and every level sees constants instead of whole subtrees beneath
+template <typename T>
+static p_bool parseFolded(Perun2Process& p2, const Tokens& tks, p_genptr<T>& result)
+{
+   if (!parseGenerator(p2, tks, result)) {
+      return false;
+   }
+
+   if (result->isFoldable() && result->getAddress() == nullptr) {
+      result = std::make_unique<gen::Constant<T>>(result->getValue());
+   }
+
+   return true;
+}
+
+p_bool parse(Perun2Process& p2, const Tokens& tks, p_genptr<p_bool>& result)
+{
+   return parseFolded(p2, tks, result);
+}
+
+p_bool parse(Perun2Process& p2, const Tokens& tks, p_genptr<p_num>& result)
+{
+   return parseFolded(p2, tks, result);
+}
+
+p_bool parse(Perun2Process& p2, const Tokens& tks, p_genptr<p_str>& result)
+{
+   return parseFolded(p2, tks, result);
+}
+
+p_bool parse(Perun2Process& p2, const Tokens& tks, p_genptr<p_nlist>& result)
+{
+   return parseFolded(p2, tks, result);
+}
+
+p_bool parse(Perun2Process& p2, const Tokens& tks, p_genptr<p_tlist>& result)
+{
+   return parseFolded(p2, tks, result);
+}
+
+p_bool parse(Perun2Process& p2, const Tokens& tks, p_genptr<p_list>& result)
+{
+   return parseFolded(p2, tks, result);
+}
+
+p_bool parse(Perun2Process& p2, const Tokens& tks, p_genptr<p_tim>& result)
+{
+   return parseFolded(p2, tks, result);
+}
+
+p_bool parse(Perun2Process& p2, const Tokens& tks, p_genptr<p_per>& result)
+{
+   return parseFolded(p2, tks, result);
+}
+
 p_bool parse(Perun2Process& p2, const Tokens& tks, p_defptr& result)
 {
    return parseDefinition(result, tks, p2);
@@ -1333,10 +1333,50 @@ static p_bool parseComparisons(p_genptr<p_bool>& result, const Tokens& tks, Peru
    return false;
 }
 
+template <typename T>
+static p_bool inPlaceComparison(p_genptr<p_bool>& result, p_genptr<T>& val1,
+   p_genptr<T>& val2, const CompType& ct)
+{
+   switch (ct) {
+      case CompType::ct_Equals: {
+         result = std::make_unique<gen::InPlaceComparison<T, std::equal_to<T>>>(val1, val2);
+         break;
+      }
+      case CompType::ct_NotEquals: {
+         result = std::make_unique<gen::InPlaceComparison<T, std::not_equal_to<T>>>(val1, val2);
+         break;
+      }
+      case CompType::ct_Smaller: {
+         result = std::make_unique<gen::InPlaceComparison<T, std::less<T>>>(val1, val2);
+         break;
+      }
+      case CompType::ct_SmallerEquals: {
+         result = std::make_unique<gen::InPlaceComparison<T, std::less_equal<T>>>(val1, val2);
+         break;
+      }
+      case CompType::ct_Bigger: {
+         result = std::make_unique<gen::InPlaceComparison<T, std::greater<T>>>(val1, val2);
+         break;
+      }
+      case CompType::ct_BiggerEquals: {
+         result = std::make_unique<gen::InPlaceComparison<T, std::greater_equal<T>>>(val1, val2);
+         break;
+      }
+      default:
+         return false;
+   };
+
+   return true;
+}
+
 template <typename T>
 static p_bool comparison(p_genptr<p_bool>& result, p_genptr<T>& val1,
    p_genptr<T>& val2, const CompType& ct)
 {
+   if (val1->getAddress() != nullptr && val2->getAddress() != nullptr) {
+      return inPlaceComparison<T>(result, val1, val2, ct);
+   }
+
    switch (ct) {
       case CompType::ct_Equals: {
          result = std::make_unique<gen::Equals<T>>(val1, val2);
@@ -1439,79 +1479,83 @@ static p_bool functionIncrConstr(p_genptr<p_bool>& result, const Tokens& tokens,
    const std::vector<Tokens> args = func::toFunctionArgs(tokens);
    const p_size argsCount = args.size();
 
-   if (word.isWord(STRING_COUNTINSIDE)) {
-      if (argsCount != 1) {
-         if (argsCount != 0) {
-            func::checkInOperatorCommaAmbiguity(word, args[0], p2);
+   switch (word.value.function) {
+      case Function::fn_CountInside: {
+         if (argsCount != 1) {
+            if (argsCount != 0) {
+               func::checkInOperatorCommaAmbiguity(word, args[0], p2);
+            }
+            func::functionArgNumberException(argsCount, word, p2);
          }
-         func::functionArgNumberException(argsCount, word, p2);
-      }
 
-      func::checkFunctionAttribute(word, p2);
+         func::checkFunctionAttribute(word, p2);
+
+         FileContext* fctx = p2.contexts.getFileContext();
+         fctx->attribute->setCoreCommandBase();
 
-      FileContext* fctx = p2.contexts.getFileContext();
-      fctx->attribute->setCoreCommandBase();
+         if (fctx->isInside) {
+            p_defptr def;
+            if (!parse::parse(p2, args[0], def)) {
+               func::functionArgException(0, STRING_DEFINITION, word, p2);
+            }
+
+            result = std::make_unique<gen::CountConstraint>(rightSide, ct, def, p2);
+            return true;
+         }
+
+         p_lcptr lctx;
+         p2.contexts.makeLocationContext(lctx);
+         p2.contexts.addLocationContext(lctx.get());
 
-      if (fctx->isInside) {
          p_defptr def;
          if (!parse::parse(p2, args[0], def)) {
             func::functionArgException(0, STRING_DEFINITION, word, p2);
          }
 
-         result = std::make_unique<gen::CountConstraint>(rightSide, ct, def, p2);
+         p2.contexts.retreatLocationContext();
+         result = std::make_unique<gen::CountInsideConstraint>(rightSide, ct, def, lctx, *fctx, p2);
          return true;
       }
+      case Function::fn_Count: {
+         if (argsCount != 1) {
+            if (argsCount != 0) {
+               func::checkInOperatorCommaAmbiguity(word, args[0], p2);
+            }
+            func::functionArgNumberException(argsCount, word, p2);
+         }
 
-      p_lcptr lctx;
-      p2.contexts.makeLocationContext(lctx);
-      p2.contexts.addLocationContext(lctx.get());
-
-      p_defptr def;
-      if (!parse::parse(p2, args[0], def)) {
-         func::functionArgException(0, STRING_DEFINITION, word, p2);
-      }
-
-      p2.contexts.retreatLocationContext();
-      result = std::make_unique<gen::CountInsideConstraint>(rightSide, ct, def, lctx, *fctx, p2);
-      return true;
-   }
-   else if (word.isWord(STRING_COUNT)) {
-      if (argsCount != 1) {
-         if (argsCount != 0) {
-            func::checkInOperatorCommaAmbiguity(word, args[0], p2);
+         p_defptr def;
+         if (parse::parse(p2, args[0], def)) {
+            result = std::make_unique<gen::CountConstraint>(rightSide, ct, def, p2);
+            return true;
          }
-         func::functionArgNumberException(argsCount, word, p2);
-      }
 
-      p_defptr def;
-      if (parse::parse(p2, args[0], def)) {
-         result = std::make_unique<gen::CountConstraint>(rightSide, ct, def, p2);
-         return true;
+         return false;
       }
+      case Function::fn_Size: {
+         if (argsCount != 1) {
+            if (argsCount != 0) {
+               func::checkInOperatorCommaAmbiguity(word, args[0], p2);
+            }
+            func::functionArgNumberException(argsCount, word, p2);
+         }
 
-      return false;
-   }
-   else if (word.isWord(STRING_SIZE)) {
-      if (argsCount != 1) {
-         if (argsCount != 0) {
-            func::checkInOperatorCommaAmbiguity(word, args[0], p2);
+         p_defptr def;
+         if (parse::parse(p2, args[0], def)) {
+            result = std::make_unique<gen::SizeConstraint_Def>(rightSide, def, ct, p2);
+            return true;
          }
-         func::functionArgNumberException(argsCount, word, p2);
-      }
 
-      p_defptr def;
-      if (parse::parse(p2, args[0], def)) {
-         result = std::make_unique<gen::SizeConstraint_Def>(rightSide, def, ct, p2);
-         return true;
-      }
+         p_genptr<p_list> list;
+         if (parse::parse(p2, args[0], list)) {
+            result = std::make_unique<gen::SizeConstraint_List>(rightSide, list, ct, p2);
+            return true;
+         }
 
-      p_genptr<p_list> list;
-      if (parse::parse(p2, args[0], list)) {
-         result = std::make_unique<gen::SizeConstraint_List>(rightSide, list, ct, p2);
-         return true;
+         return false;
       }
-
-      return false;
+      default:
+         break;
    }
 
    return false;
@@ -17,6 +17,7 @@
 #include "../../../include/perun2/lexer.hpp"
 #include "../../../include/perun2/datatype/order.hpp"
 #include "../../../include/perun2/datatype/generator/gen-definition.hpp"
+#include "../../../include/perun2/datatype/generator/gen-prefetch.hpp"
 #include "../../../include/perun2/datatype/cast.hpp"
 #include "../../../include/perun2/datatype/parse/parse-function.hpp"
 #include "../../../include/perun2/datatype/parse/parse-generic.hpp"
@@ -249,8 +250,17 @@ static p_bool parseDefFilter(p_defptr& result, const Tokens& tks, Perun2Process&
 
    FileContext* contextPtr = base->getFileContext();
    if (contextPtr == nullptr) {
+      p_fcptr context = std::make_unique<FileContext>(p2);
+
+      // the filters are not parsed yet and a loop over them may read more attributes of this context
+      // so the prefetch decides by itself whether it is needed
+      if (p2.flags & FLAG_MAX_PERFORMANCE) {
+         p_defptr unprefetched = std::move(base);
+         base = std::make_unique<gen::DefPrefetch>(unprefetched, context.get(), p2);
+      }
+
       p_defptr prev = std::move(base);
-      base = std::make_unique<gen::DefWithContext>(prev, p2);
+      base = std::make_unique<gen::DefWithContext>(prev, context);
       contextPtr = base->getFileContext();
    }
 
@@ -16,25 +16,43 @@
 #include "../../../include/perun2/datatype/text/strings.hpp"
 #include "../../../include/perun2/util.hpp"
 #include <set>
+#include <algorithm>
+#include <cwchar>
 
 
 namespace perun2::gen
 {
 
-LikeSet::LikeSet(const std::unordered_set<p_char>& vals, const p_bool neg)
-   : values(vals), negated(neg) { };
+LikeSet::LikeSet(const std::vector<LikeRange>& rngs, const p_bool neg)
+   : ranges(rngs), negated(neg) { };
 
 
 p_bool LikeSet::contains(const p_char ch) const
 {
-   return this->negated
-      ? this->values.find(ch) == this->values.end()
-      : this->values.find(ch) != this->values.end();
+   for (const LikeRange& range : this->ranges) {
+      if (ch >= range.first && ch <= range.last) {
+         return !this->negated;
+      }
+   }
+
+   return this->negated;
+}
+
+
+void LikeSet::addBounds(std::vector<p_char>& bounds) const
+{
+   for (const LikeRange& range : this->ranges) {
+      bounds.push_back(range.first);
+
+      if (range.last != WCHAR_MAX) {
+         bounds.push_back(range.last + 1);
+      }
+   }
 }
 
 static LikeSet makeLikeSet(const p_str& pattern, p_size startId, const p_size endId)
 {
-   std::unordered_set<p_char> set;
+   std::vector<LikeRange> ranges;
    p_bool negated = false;
 
    if (pattern[startId] == WILDCARD_SET_EXCLUSION) {
@@ -48,24 +66,20 @@ static LikeSet makeLikeSet(const p_str& pattern, p_size startId, const p_size en
          const p_char right = pattern[i + 2];
 
          if (left < right) {
-            for (p_char ch = left; ch <= right; ch++) {
-               set.insert(ch);
-            }
+            ranges.push_back({ left, right });
          }
          else {
-            for (p_char ch = right; ch <= left; ch++) {
-               set.insert(ch);
-            }
+            ranges.push_back({ right, left });
          }
 
          i+= 2;
       }
       else {
-         set.insert(pattern[i]);
+         ranges.push_back({ pattern[i], pattern[i] });
       }
    }
 
-   return LikeSet(set, negated);
+   return LikeSet(ranges, negated);
 }
 
 static void defaultLikeCmp(p_likeptr& result, const p_str& pattern)
@@ -449,94 +463,224 @@ p_bool Like::getValue()
 
 
 LC_Default::LC_Default(const p_str& pat, const std::unordered_map<p_size, LikeSet>& cs)
-   : WildcardComparer(pat), charSets(cs) 
+   : pattern(pat), patternLength(pat.size()), wordsCount(pat.size() / LIKE_BITS_IN_WORD + 1)
 { 
-   minLength = this->getMinLength(pat);
+   this->compile(cs);
 };
 
 LC_Default::LC_Default(const p_str& pat)
-   : WildcardComparer(pat) 
+   : pattern(pat), patternLength(pat.size()), wordsCount(pat.size() / LIKE_BITS_IN_WORD + 1)
 { 
-   minLength = this->getMinLength(pat);
+   this->compile(std::unordered_map<p_size, LikeSet>());
 };
 
 
-Logic LC_Default::checkState(const p_size n, const p_size m)
+void LC_Default::compile(const std::unordered_map<p_size, LikeSet>& cs)
 {
-   if (this->charStates[n][m] != Logic::Unknown) {
-      return this->charStates[n][m];
-   }
-
-   if (n == 0 && m == 0) {
-      this->charStates[n][m] = Logic::True;
-      return Logic::True;
-   }
-
-   if (n > 0 && m == 0) {
-      this->charStates[n][m] = Logic::False;
-      return Logic::False;
-   }
+   // find the bounds of the character classes
+   this->bounds.push_back(0);
 
-   Logic ans = Logic::False;
+   for (p_size i = 0; i < this->patternLength; i++) {
+      const p_char ch = this->pattern[i];
 
-   if (this->pattern[m - 1] == WILDCARD_MULTIPLE_CHARS) {
-      ans = perun2::langutil::maximum(ans, this->checkState(n, m - 1));
-      if (n > 0) {
-         ans = perun2::langutil::maximum(ans, this->checkState(n - 1, m));
-      }
-   }
-
-   if (n > 0) {
-      const p_char pch = this->pattern[m - 1];
-
-      switch (pch) {
+      switch (ch) {
+         case WILDCARD_MULTIPLE_CHARS: {
+            break;
+         }
          case WILDCARD_ONE_CHAR: {
-            ans = perun2::langutil::maximum(ans, this->checkState(n - 1, m - 1));
+            this->minLength++;
             break;
          }
          case WILDCARD_ONE_DIGIT: {
-            if (char_isDigit((*this->valuePtr)[n - 1])) {
-               ans = perun2::langutil::maximum(ans, this->checkState(n - 1, m - 1));
-            }
+            // the result of char_isDigit() is added to the class
+            // so non-ASCII digits are treated exactly as before
+            this->hasDigits = true;
+            this->minLength++;
             break;
          }
          case WILDCARD_SET: {
-            if (this->charSets.at(m - 1).contains((*this->valuePtr)[n - 1])) {
-               ans = perun2::langutil::maximum(ans, this->checkState(n - 1, m - 1));
-            }
+            cs.at(i).addBounds(this->bounds);
+            this->minLength++;
             break;
          }
          default: {
-            if (pch == (*this->valuePtr)[n - 1]) {
-               ans = perun2::langutil::maximum(ans, this->checkState(n - 1, m - 1));
+            this->bounds.push_back(ch);
+            if (ch != WCHAR_MAX) {
+               this->bounds.push_back(ch + 1);
             }
+            this->minLength++;
             break;
          }
       }
    }
 
-   this->charStates[n][m] = ans;
-   return ans;
+   std::sort(this->bounds.begin(), this->bounds.end());
+   this->bounds.erase(std::unique(this->bounds.begin(), this->bounds.end()), this->bounds.end());
+
+   const p_size intervals = this->bounds.size();
+   this->classesCount = this->hasDigits ? intervals * 2 : intervals;
+
+   this->asciiClasses.resize(LIKE_ASCII_END);
+   p_size interval = 0;
+
+   for (p_size i = 0; i < LIKE_ASCII_END; i++) {
+      while (interval + 1 < intervals && static_cast<p_size>(this->bounds[interval + 1]) <= i) {
+         interval++;
+      }
+      this->asciiClasses[i] = interval;
+   }
+
+   // every class is represented by the first character of its interval
+   this->elementMatches.resize(this->patternLength * this->classesCount, false);
+
+   for (p_size i = 0; i < this->patternLength; i++) {
+      const p_char pch = this->pattern[i];
+
+      for (p_size c = 0; c < this->classesCount; c++) {
+         const p_char ch = this->bounds[this->hasDigits ? c / 2 : c];
+         p_bool matches;
+
+         switch (pch) {
+            case WILDCARD_MULTIPLE_CHARS: 
+            case WILDCARD_ONE_CHAR: {
+               matches = true;
+               break;
+            }
+            case WILDCARD_ONE_DIGIT: {
+               matches = (c % 2 == 1);
+               break;
+            }
+            case WILDCARD_SET: {
+               matches = cs.at(i).contains(ch);
+               break;
+            }
+            default: {
+               matches = (pch == ch);
+               break;
+            }
+         }
+
+         this->elementMatches[i * this->classesCount + c] = matches;
+      }
+   }
+
+   this->clearStates();
+}
+
+
+p_size LC_Default::getClass(const p_char ch) const
+{
+   const p_size code = static_cast<p_size>(ch);
+   const p_size interval = code < LIKE_ASCII_END
+      ? this->asciiClasses[code]
+      : static_cast<p_size>(std::upper_bound(this->bounds.begin(), this->bounds.end(), ch) - this->bounds.begin()) - 1;
+
+   return this->hasDigits
+      ? interval * 2 + (char_isDigit(ch) ? 1 : 0)
+      : interval;
+}
+
+
+// the start state contains the first element and everything reachable from it through the percent signs
+void LC_Default::clearStates()
+{
+   this->states.clear();
+   this->stateIds.clear();
+   this->transitions.clear();
+   this->acceptingStates.clear();
+   this->deadStates.clear();
+
+   std::vector<uint64_t> start(this->wordsCount, 0);
+   start[0] = 1;
+   this->addState(start);
 }
 
 
-p_size LC_Default::getMinLength(const p_str& pat) const
+p_int LC_Default::addState(const std::vector<uint64_t>& positions)
 {
-   p_size result = 0;
+   std::vector<uint64_t> closure = positions;
+   p_bool empty = true;
+
+   for (p_size i = 0; i <= this->patternLength; i++) {
+      if ((closure[i / LIKE_BITS_IN_WORD] >> (i % LIKE_BITS_IN_WORD)) & 1) {
+         empty = false;
 
-   for (const p_char ch : pat) {
-      if (ch != WILDCARD_MULTIPLE_CHARS) {
-         result++;
+         if (i < this->patternLength && this->pattern[i] == WILDCARD_MULTIPLE_CHARS) {
+            const p_size next = i + 1;
+            closure[next / LIKE_BITS_IN_WORD] |= static_cast<uint64_t>(1) << (next % LIKE_BITS_IN_WORD);
+         }
       }
    }
 
-   return result;
+   const auto found = this->stateIds.find(closure);
+   if (found != this->stateIds.end()) {
+      return found->second;
+   }
+
+   const p_int id = static_cast<p_int>(this->states.size());
+   const p_size last = this->patternLength;
+
+   this->acceptingStates.push_back((closure[last / LIKE_BITS_IN_WORD] >> (last % LIKE_BITS_IN_WORD)) & 1);
+   this->deadStates.push_back(empty);
+   this->transitions.resize(this->transitions.size() + this->classesCount, LIKE_DFA_UNKNOWN);
+   this->stateIds.emplace(closure, id);
+   this->states.push_back(std::move(closure));
+   return id;
+}
+
+
+p_int LC_Default::getNextState(const p_int state, const p_size cls)
+{
+   const std::vector<uint64_t>& source = this->states[state];
+   std::vector<uint64_t> target(this->wordsCount, 0);
+
+   for (p_size i = 0; i < this->patternLength; i++) {
+      if (((source[i / LIKE_BITS_IN_WORD] >> (i % LIKE_BITS_IN_WORD)) & 1) == 0) {
+         continue;
+      }
+
+      if (this->pattern[i] == WILDCARD_MULTIPLE_CHARS) {
+         target[i / LIKE_BITS_IN_WORD] |= static_cast<uint64_t>(1) << (i % LIKE_BITS_IN_WORD);
+      }
+      else if (this->elementMatches[i * this->classesCount + cls]) {
+         const p_size next = i + 1;
+         target[next / LIKE_BITS_IN_WORD] |= static_cast<uint64_t>(1) << (next % LIKE_BITS_IN_WORD);
+      }
+   }
+
+   if (this->states.size() >= LIKE_DFA_MAX_STATES) {
+      this->clearStates();
+      return this->addState(target);
+   }
+
+   const p_int next = this->addState(target);
+   this->transitions[state * this->classesCount + cls] = next;
+   return next;
 }
 
 
 p_bool LC_Default::compareToPattern(const p_str& value)
 {
-   return this->matches(value);
+   if (value.size() < this->minLength) {
+      return false;
+   }
+
+   p_int state = 0;
+
+   for (const p_char ch : value) {
+      const p_size cls = this->getClass(ch);
+      const p_int next = this->transitions[state * this->classesCount + cls];
+
+      state = next == LIKE_DFA_UNKNOWN
+         ? this->getNextState(state, cls)
+         : next;
+
+      if (this->deadStates[state]) {
+         return false;
+      }
+   }
+
+   return this->acceptingStates[state];
 }
 
 
@@ -20,588 +20,582 @@ namespace perun2
 
 void str_toRaw(p_str& value)
 {
-   uint32_t doubleChars = TO_RAW_DOUBLECHARS_NONE;
-
-   for (p_int i = 0; i < static_cast<p_int>(value.size()); i++) {
-      switch (value[i]) {
-         case 0x0153:
-         {
-            doubleChars |= TO_RAW_DOUBLECHARS_LOWER_OE;
-            break;
-         }
-         case 0x00E6:
-         {
-            doubleChars |= TO_RAW_DOUBLECHARS_LOWER_AE;
-            break;
-         }
-         case 0x01FD:
-         {
-            doubleChars |= TO_RAW_DOUBLECHARS_LOWER_AE_ACCENT;
-            break;
-         }
-         case 0x01E3:
-         {
-            doubleChars |= TO_RAW_DOUBLECHARS_LOWER_AE_MACRON;
-            break;
-         }
-         case 0x0152:
-         {
-            doubleChars |= TO_RAW_DOUBLECHARS_UPPER_OE;
-            break;
-         }
-         case 0x00C6:
-         {
-            doubleChars |= TO_RAW_DOUBLECHARS_UPPER_AE;
-            break;
-         }
-         case 0x01FC:
-         {
-            doubleChars |= TO_RAW_DOUBLECHARS_UPPER_AE_ACCENT;
-            break;
-         }
-         case 0x01E2:
-         {
-            doubleChars |= TO_RAW_DOUBLECHARS_UPPER_AE_MACRON;
-            break;
-         }
-         case 0x00DF: {
-            doubleChars |= TO_RAW_DOUBLECHARS_ESZETT;
-            break;
-         }
-         case 0x0104:
-         case 0x00C1:
-         case 0x00C0:
-         case 0x0226:
-         case 0x00C2:
-         case 0x00C4:
-         case 0x01DE:
-         case 0x01CD:
-         case 0x0102:
-         case 0x0100:
-         case 0x00C3:
-         case 0x00C5:
-         case 0x01FA:
-         {
-            value[i] = L'A';
-            break;
-         }
-         case 0x0181:
-         case 0x1E04:
-         {
-            value[i] = L'B';
-            break;
-         }
-         case 0x0187:
-         case 0x00C7:
-         case 0x0106:
-         case 0x010A:
-         case 0x0108:
-         case 0x010C:
-         {
-            value[i] = L'C';
-            break;
-         }
-         case 0x0110:
-         case 0x018A:
-         case 0x0189:
-         case 0x010E:
-         case 0x1E0C:
-         case 0x1E10:
-         case 0x1E12:
-         {
-            value[i] = L'D';
-            break;
-         }
-         case 0x0118:
-         case 0x0228:
-         case 0x00C9:
-         case 0x00C8:
-         case 0x0116:
-         case 0x00CA:
-         case 0x00CB:
-         case 0x011A:
-         case 0x0114:
-         case 0x0112:
-         case 0x1EBC:
-         case 0x1EB8:
-         {
-            value[i] = L'E';
-            break;
-         }
-         case 0x0191:
-         {
-            value[i] = L'F';
-            break;
-         }
-         case 0x01E4:
-         case 0x0193:
-         case 0x01F4:
-         case 0x0120:
-         case 0x011C:
-         case 0x01E6:
-         case 0x011E:
-         case 0x0122:
-         {
-            value[i] = L'G';
-            break;
-         }
-         case 0x0126:
-         case 0xA7AA:
-         case 0x0124:
-         case 0x1E24:
-         {
-            value[i] = L'H';
-            break;
-         }
-         case 0x012E:
-         case 0x0197:
-         case 0x00CD:
-         case 0x00CC:
-         case 0x0130:
-         case 0x00CE:
-         case 0x00CF:
-         case 0x01CF:
-         case 0x012C:
-         case 0x012A:
-         case 0x0128:
-         case 0x1ECA:
-         {
-            value[i] = L'I';
-            break;
-         }
-         case 0x0134:
-         {
-            value[i] = L'J';
-            break;
-         }
-         case 0x0198:
-         case 0x0136:
-         case 0x01E8:
-         {
-            value[i] = L'K';
-            break;
-         }
-         case 0x0141:
-         case 0x0139:
-         case 0x013B:
-         case 0x013D:
-         case 0x013F:
-         case 0x1E36:
-         case 0x1E3C:
-         {
-            value[i] = L'L';
-            break;
-         }
-         case 0x019D:
-         // notice that there is no ʼN character here
-         // the N-apostrophe character from Afrikaans has only lower case variant
-         // upper case has never been included in any international keyboard
-         case 0x0143:
-         case 0x1E44:
-         case 0x0147:
-         case 0x00D1:
-         case 0x0145:
-         case 0x1E4A:
-         {
-            value[i] = L'N';
-            break;
-         }
-         case 0x01EA:
-         case 0x00D8:
-         case 0x01A0:
-         case 0x00D3:
-         case 0x00D2:
-         case 0x022E:
-         case 0x0230:
-         case 0x00D4:
-         case 0x00D6:
-         case 0x022A:
-         case 0x01D1:
-         case 0x014E:
-         case 0x014C:
-         case 0x00D5:
-         case 0x022C:
-         case 0x0150:
-         case 0x1ECC:
-         case 0x01FE:
-         {
-            value[i] = L'O';
-            break;
-         }
-         case 0x01A4:
-         {
-            value[i] = L'P';
-            break;
-         }
-         case 0x024C:
-         case 0x0154:
-         case 0x0158:
-         case 0x0156:
-         case 0x1E5A:
-         {
-            value[i] = L'R';
-            break;
-         }
-         case 0x015E:
-         case 0x015A:
-         case 0x015C:
-         case 0x1E60:
-         case 0x0160:
-         case 0x0218:
-         case 0x1E62:
-         {
-            value[i] = L'S';
-            break;
-         }
-         case 0x01AC:
-         case 0x0162:
-         case 0x0166:
-         case 0x0164:
-         case 0x021A:
-         case 0x1E6C:
-         case 0x1E70:
-         {
-            value[i] = L'T';
-            break;
-         }
-         case 0x0172:
-         case 0x01AF:
-         case 0x0244:
-         case 0x00DA:
-         case 0x00D9:
-         case 0x00DB:
-         case 0x00DC:
-         case 0x01D3:
-         case 0x016C:
-         case 0x016A:
-         case 0x0168:
-         case 0x0170:
-         case 0x016E:
-         case 0x1EE4:
-         {
-            value[i] = L'U';
-            break;
-         }
-         case 0x1E82:
-         case 0x1E80:
-         case 0x0174:
-         case 0x1E84:
-         {
-            value[i] = L'W';
-            break;
-         }
-         case 0x1E8A:
-         {
-            value[i] = L'X';
-            break;
-         }
-         case 0x01B3:
-         case 0x00DD:
-         case 0x1EF2:
-         case 0x0176:
-         case 0x0178:
-         case 0x0232:
-         case 0x1EF8:
-         {
-            value[i] = L'Y';
-            break;
-         }
-         case 0x0179:  
-         case 0x017B:
-         case 0x017D:
-         case 0x1E92:
-         {
-            value[i] = L'Z';
-            break;
-         }
-         case 0x0105:
-         case 0x00E1:
-         case 0x00E0:
-         case 0x0227:
-         case 0x00E2:
-         case 0x00E4:
-         case 0x01DF:
-         case 0x01CE:
-         case 0x0103:
-         case 0x0101:
-         case 0x00E3:
-         case 0x00E5:
-         case 0x01FB: {
-            value[i] = L'a';
-            break;
-         }
-         case 0x0253:
-         case 0x1E05: {
-            value[i] = L'b';
-            break;
-         }
-         case 0x0188:
-         case 0x00E7:
-         case 0x0107:
-         case 0x010B:
-         case 0x0109:
-         case 0x010D: {
-            value[i] = L'c';
-            break;
-         }
-         case 0x0111:
-         case 0x0257:
-         case 0x0256:
-         case 0x010F:
-         case 0x1E0D:
-         case 0x1E11:
-         case 0x1E13: {
-            value[i] = L'd';
-            break;
-         }
-         case 0x0119:
-         case 0x0229:
-         case 0x00E9:
-         case 0x00E8:
-         case 0x0117:
-         case 0x00EA:
-         case 0x00EB:
-         case 0x011B:
-         case 0x0115:
-         case 0x0113:
-         case 0x1EBD:
-         case 0x1EB9: {
-            value[i] = L'e';
-            break;
-         }
-         case 0x0192: {
-            value[i] = L'f';
-            break;
-         }
-         case 0x01E5:
-         case 0x0260:
-         case 0x01F5:
-         case 0x0121:
-         case 0x011D:
-         case 0x01E7:
-         case 0x011F:
-         case 0x0123: {
-            value[i] = L'g';
-            break;
-         }
-         case 0x0127:
-         case 0x0266:
-         case 0x0125:
-         case 0x1E25: {
-            value[i] = L'h';
-            break;
-         }
-         case 0x012F:
-         case 0x0268:
-         case 0x00ED:
-         case 0x00EC:
-         case 0x00EE:
-         case 0x00EF:
-         case 0x01D0:
-         case 0x012D:
-         case 0x012B:
-         case 0x0129:
-         case 0x1ECB: {
-            value[i] = L'i';
-            break;
-         }
-         case 0x0135: {
-            value[i] = L'j';
-            break;
-         }
-         case 0x0199:
-         case 0x0137:
-         case 0x01E9: {
-            value[i] = L'k';
-            break;
-         }
-         case 0x0142:
-         case 0x013A:
-         case 0x013C:
-         case 0x013E:
-         case 0x0140:
-         case 0x1E37:
-         case 0x1E3D: {
-            value[i] = L'l';
-            break;
-         }
-         case 0x0272:
-         case 0x0149:
-         case 0x0144:
-         case 0x1E45:
-         case 0x0148:
-         case 0x00F1:
-         case 0x0146:
-         case 0x1E4B: {
-            value[i] = L'n';
-            break;
-         }
-         case 0x01EB:
-         case 0x00F8:
-         case 0x01A1:
-         case 0x00F3:
-         case 0x00F2:
-         case 0x022F:
-         case 0x0231:
-         case 0x00F4:
-         case 0x00F6:
-         case 0x022B:
-         case 0x01D2:
-         case 0x014F:
-         case 0x014D:
-         case 0x00F5:
-         case 0x022D:
-         case 0x0151:
-         case 0x1ECD:
-         case 0x01FF: {
-            value[i] = L'o';
-            break;
-         }
-         case 0x01A5:
-         {
-            value[i] = L'p';
-            break;
-         }
-         case 0x024D:
-         case 0x0155:
-         case 0x0159:
-         case 0x0157:
-         case 0x1E5B: {
-            value[i] = L'r';
-            break;
-         }
-         case 0x015F:
-         case 0x015B:
-         case 0x015D:
-         case 0x1E61:
-         case 0x0161:
-         case 0x0219:
-         case 0x1E63: {
-            value[i] = L's';
-            break;
-         }
-         case 0x01AD:
-         case 0x0163:
-         case 0x0167:
-         case 0x0165:
-         case 0x021B:
-         case 0x1E6D:
-         case 0x1E71: {
-            value[i] = L't';
-            break;
-         }
-         case 0x0173:
-         case 0x01B0:
-         case 0x0289:
-         case 0x00FA:
-         case 0x00F9:
-         case 0x00FB:
-         case 0x00FC:
-         case 0x01D4:
-         case 0x016D:
-         case 0x016B:
-         case 0x0169:
-         case 0x0171:
-         case 0x016F:
-         case 0x1EE5: {
-            value[i] = L'u';
-            break;
-         }
-         case 0x1E83:
-         case 0x1E81:
-         case 0x0175:
-         case 0x1E85: {
-            value[i] = L'w';
-            break;
-         }
-         case 0x1E8B: {
-            value[i] = L'x';
-            break;
-         }
-         case 0x01B4:
-         case 0x00FD:
-         case 0x1EF3:
-         case 0x0177:
-         case 0x00FF:
-         case 0x0233:
-         case 0x1EF9: {
-            value[i] = L'y';
-            break;
-         }
-         case 0x017A:
-         case 0x017C:
-         case 0x017E:
-         case 0x1E93: {
-            value[i] = L'z';
-            break;
-         }
-         default: {
-            if (isCombiningMark(value[i])) {
-               value.erase(i, 1);
-               i--;
-            }
-            break;
-         }
-      }
+   const p_size length = value.size();
+
+   // most strings are pure ASCII and stay untouched
+   // this loop has no branches, so the compiler can vectorize it
+   p_char combined = 0;
+
+   for (p_size i = 0; i < length; i++) {
+      combined |= value[i];
    }
 
-   if (doubleChars == TO_RAW_DOUBLECHARS_NONE) {
+   if (static_cast<uint32_t>(combined) < TO_RAW_ASCII_END) {
       return;
    }
 
-   if (doubleChars & TO_RAW_DOUBLECHARS_LOWER_OE) {
-      replaceCharWithTwoChars(value, 0x0153, L'o', L'e');
-   }
+   const RawTable& table = getRawTable();
+   p_size i = 0;
 
-   if (doubleChars & TO_RAW_DOUBLECHARS_LOWER_AE) {
-      replaceCharWithTwoChars(value, 0x00E6, L'a', L'e');
-   }
+   // characters are replaced in place until the length of the string has to change
+   for (; i < length; i++) {
+      const uint32_t raw = table.get(value[i]);
 
-   if (doubleChars & TO_RAW_DOUBLECHARS_LOWER_AE_ACCENT) {
-      replaceCharWithTwoChars(value, 0x01FD, L'a', L'e');
-   }
+      if (raw > TO_RAW_MAX_CHAR) {
+         break;
+      }
 
-   if (doubleChars & TO_RAW_DOUBLECHARS_LOWER_AE_MACRON) {
-      replaceCharWithTwoChars(value, 0x01E3, L'a', L'e');
+      value[i] = static_cast<p_char>(raw);
    }
 
-   if (doubleChars & TO_RAW_DOUBLECHARS_UPPER_OE) {
-      replaceCharWithTwoChars(value, 0x0152, L'O', L'E');
+   if (i == length) {
+      return;
    }
 
-   if (doubleChars & TO_RAW_DOUBLECHARS_UPPER_AE) {
-      replaceCharWithTwoChars(value, 0x00C6, L'A', L'E');
-   }
+   p_str result;
+   result.reserve(length + length / 2);
+   result.append(value, 0, i);
+
+   for (; i < length; i++) {
+      const uint32_t raw = table.get(value[i]);
+
+      if (raw == TO_RAW_REMOVED) {
+         continue;
+      }
 
-   if (doubleChars & TO_RAW_DOUBLECHARS_UPPER_AE_ACCENT) {
-      replaceCharWithTwoChars(value, 0x01FC, L'A', L'E');
+      if (raw > TO_RAW_MAX_CHAR) {
+         result.push_back(static_cast<p_char>(raw & TO_RAW_MAX_CHAR));
+         result.push_back(static_cast<p_char>(raw >> TO_RAW_SECOND_SHIFT));
+      }
+      else {
+         result.push_back(static_cast<p_char>(raw));
+      }
    }
 
-   if (doubleChars & TO_RAW_DOUBLECHARS_UPPER_AE_MACRON) {
-      replaceCharWithTwoChars(value, 0x01E2, L'A', L'E');
+   value = std::move(result);
+}
+
+
+RawTable::RawTable()
+{
+   for (p_size block = 0; block < TO_RAW_BLOCKS; block++) {
+      const p_size first = block * TO_RAW_BLOCK_SIZE;
+      std::vector<uint32_t> values(TO_RAW_BLOCK_SIZE);
+      p_bool changed = false;
+
+      for (p_size i = 0; i < TO_RAW_BLOCK_SIZE; i++) {
+         const uint32_t ch = static_cast<uint32_t>(first + i);
+         values[i] = toRawChar(static_cast<p_char>(ch));
+         changed |= (values[i] != ch);
+      }
+
+      // blocks of unchanged characters share one table
+      if (changed) {
+         this->blocks[block] = this->changedBlocks.size();
+         this->changedBlocks.push_back(std::move(values));
+      }
+      else {
+         this->blocks[block] = TO_RAW_IDENTITY_BLOCK;
+      }
    }
+}
+
+
+uint32_t RawTable::get(const p_char ch) const
+{
+   const uint32_t code = static_cast<uint32_t>(ch);
 
-   if (doubleChars & TO_RAW_DOUBLECHARS_ESZETT) {
-      replaceCharWithTwoChars(value, 0x00DF, L's', L's');
+   if (code > TO_RAW_MAX_CHAR) {
+      return code;
    }
+
+   const p_size block = this->blocks[code >> TO_RAW_BLOCK_BITS];
+   const p_size offset = code & (TO_RAW_BLOCK_SIZE - 1);
+
+   return block == TO_RAW_IDENTITY_BLOCK
+      ? code
+      : this->changedBlocks[block][offset];
 }
 
 
-inline static void replaceCharWithTwoChars(p_str& value,
-   const p_char old, const p_char new1, const p_char new2)
+// the table is built once, on the first use
+static const RawTable& getRawTable()
 {
-   p_size pos = value.find(old);
+   static const RawTable table;
+   return table;
+}
 
-   while (pos != p_str::npos) {
-      value += value[value.size() - 1];
 
-      for (p_size i = value.size() - 2; i > pos + 1; i--) {
-         value[i] = value[i - 1];
-      }
+inline static uint32_t toRawPair(const p_char first, const p_char second)
+{
+   return static_cast<uint32_t>(first) | (static_cast<uint32_t>(second) << TO_RAW_SECOND_SHIFT);
+}
+
 
-      value[pos] = new1;
-      value[pos + 1] = new2;
-      pos = value.find(old, pos + 2);
+static uint32_t toRawChar(const p_char ch)
+{
+   switch (ch) {
+      case 0x0153:
+      {
+         return toRawPair(L'o', L'e');
+      }
+      case 0x00E6:
+      {
+         return toRawPair(L'a', L'e');
+      }
+      case 0x01FD:
+      {
+         return toRawPair(L'a', L'e');
+      }
+      case 0x01E3:
+      {
+         return toRawPair(L'a', L'e');
+      }
+      case 0x0152:
+      {
+         return toRawPair(L'O', L'E');
+      }
+      case 0x00C6:
+      {
+         return toRawPair(L'A', L'E');
+      }
+      case 0x01FC:
+      {
+         return toRawPair(L'A', L'E');
+      }
+      case 0x01E2:
+      {
+         return toRawPair(L'A', L'E');
+      }
+      case 0x00DF: {
+         return toRawPair(L's', L's');
+      }
+      case 0x0104:
+      case 0x00C1:
+      case 0x00C0:
+      case 0x0226:
+      case 0x00C2:
+      case 0x00C4:
+      case 0x01DE:
+      case 0x01CD:
+      case 0x0102:
+      case 0x0100:
+      case 0x00C3:
+      case 0x00C5:
+      case 0x01FA:
+      {
+         return L'A';
+      }
+      case 0x0181:
+      case 0x1E04:
+      {
+         return L'B';
+      }
+      case 0x0187:
+      case 0x00C7:
+      case 0x0106:
+      case 0x010A:
+      case 0x0108:
+      case 0x010C:
+      {
+         return L'C';
+      }
+      case 0x0110:
+      case 0x018A:
+      case 0x0189:
+      case 0x010E:
+      case 0x1E0C:
+      case 0x1E10:
+      case 0x1E12:
+      {
+         return L'D';
+      }
+      case 0x0118:
+      case 0x0228:
+      case 0x00C9:
+      case 0x00C8:
+      case 0x0116:
+      case 0x00CA:
+      case 0x00CB:
+      case 0x011A:
+      case 0x0114:
+      case 0x0112:
+      case 0x1EBC:
+      case 0x1EB8:
+      {
+         return L'E';
+      }
+      case 0x0191:
+      {
+         return L'F';
+      }
+      case 0x01E4:
+      case 0x0193:
+      case 0x01F4:
+      case 0x0120:
+      case 0x011C:
+      case 0x01E6:
+      case 0x011E:
+      case 0x0122:
+      {
+         return L'G';
+      }
+      case 0x0126:
+      case 0xA7AA:
+      case 0x0124:
+      case 0x1E24:
+      {
+         return L'H';
+      }
+      case 0x012E:
+      case 0x0197:
+      case 0x00CD:
+      case 0x00CC:
+      case 0x0130:
+      case 0x00CE:
+      case 0x00CF:
+      case 0x01CF:
+      case 0x012C:
+      case 0x012A:
+      case 0x0128:
+      case 0x1ECA:
+      {
+         return L'I';
+      }
+      case 0x0134:
+      {
+         return L'J';
+      }
+      case 0x0198:
+      case 0x0136:
+      case 0x01E8:
+      {
+         return L'K';
+      }
+      case 0x0141:
+      case 0x0139:
+      case 0x013B:
+      case 0x013D:
+      case 0x013F:
+      case 0x1E36:
+      case 0x1E3C:
+      {
+         return L'L';
+      }
+      case 0x019D:
+      // notice that there is no ʼN character here
+      // the N-apostrophe character from Afrikaans has only lower case variant
+      // upper case has never been included in any international keyboard
+      case 0x0143:
+      case 0x1E44:
+      case 0x0147:
+      case 0x00D1:
+      case 0x0145:
+      case 0x1E4A:
+      {
+         return L'N';
+      }
+      case 0x01EA:
+      case 0x00D8:
+      case 0x01A0:
+      case 0x00D3:
+      case 0x00D2:
+      case 0x022E:
+      case 0x0230:
+      case 0x00D4:
+      case 0x00D6:
+      case 0x022A:
+      case 0x01D1:
+      case 0x014E:
+      case 0x014C:
+      case 0x00D5:
+      case 0x022C:
+      case 0x0150:
+      case 0x1ECC:
+      case 0x01FE:
+      {
+         return L'O';
+      }
+      case 0x01A4:
+      {
+         return L'P';
+      }
+      case 0x024C:
+      case 0x0154:
+      case 0x0158:
+      case 0x0156:
+      case 0x1E5A:
+      {
+         return L'R';
+      }
+      case 0x015E:
+      case 0x015A:
+      case 0x015C:
+      case 0x1E60:
+      case 0x0160:
+      case 0x0218:
+      case 0x1E62:
+      {
+         return L'S';
+      }
+      case 0x01AC:
+      case 0x0162:
+      case 0x0166:
+      case 0x0164:
+      case 0x021A:
+      case 0x1E6C:
+      case 0x1E70:
+      {
+         return L'T';
+      }
+      case 0x0172:
+      case 0x01AF:
+      case 0x0244:
+      case 0x00DA:
+      case 0x00D9:
+      case 0x00DB:
+      case 0x00DC:
+      case 0x01D3:
+      case 0x016C:
+      case 0x016A:
+      case 0x0168:
+      case 0x0170:
+      case 0x016E:
+      case 0x1EE4:
+      {
+         return L'U';
+      }
+      case 0x1E82:
+      case 0x1E80:
+      case 0x0174:
+      case 0x1E84:
+      {
+         return L'W';
+      }
+      case 0x1E8A:
+      {
+         return L'X';
+      }
+      case 0x01B3:
+      case 0x00DD:
+      case 0x1EF2:
+      case 0x0176:
+      case 0x0178:
+      case 0x0232:
+      case 0x1EF8:
+      {
+         return L'Y';
+      }
+      case 0x0179:  
+      case 0x017B:
+      case 0x017D:
+      case 0x1E92:
+      {
+         return L'Z';
+      }
+      case 0x0105:
+      case 0x00E1:
+      case 0x00E0:
+      case 0x0227:
+      case 0x00E2:
+      case 0x00E4:
+      case 0x01DF:
+      case 0x01CE:
+      case 0x0103:
+      case 0x0101:
+      case 0x00E3:
+      case 0x00E5:
+      case 0x01FB: {
+         return L'a';
+      }
+      case 0x0253:
+      case 0x1E05: {
+         return L'b';
+      }
+      case 0x0188:
+      case 0x00E7:
+      case 0x0107:
+      case 0x010B:
+      case 0x0109:
+      case 0x010D: {
+         return L'c';
+      }
+      case 0x0111:
+      case 0x0257:
+      case 0x0256:
+      case 0x010F:
+      case 0x1E0D:
+      case 0x1E11:
+      case 0x1E13: {
+         return L'd';
+      }
+      case 0x0119:
+      case 0x0229:
+      case 0x00E9:
+      case 0x00E8:
+      case 0x0117:
+      case 0x00EA:
+      case 0x00EB:
+      case 0x011B:
+      case 0x0115:
+      case 0x0113:
+      case 0x1EBD:
+      case 0x1EB9: {
+         return L'e';
+      }
+      case 0x0192: {
+         return L'f';
+      }
+      case 0x01E5:
+      case 0x0260:
+      case 0x01F5:
+      case 0x0121:
+      case 0x011D:
+      case 0x01E7:
+      case 0x011F:
+      case 0x0123: {
+         return L'g';
+      }
+      case 0x0127:
+      case 0x0266:
+      case 0x0125:
+      case 0x1E25: {
+         return L'h';
+      }
+      case 0x012F:
+      case 0x0268:
+      case 0x00ED:
+      case 0x00EC:
+      case 0x00EE:
+      case 0x00EF:
+      case 0x01D0:
+      case 0x012D:
+      case 0x012B:
+      case 0x0129:
+      case 0x1ECB: {
+         return L'i';
+      }
+      case 0x0135: {
+         return L'j';
+      }
+      case 0x0199:
+      case 0x0137:
+      case 0x01E9: {
+         return L'k';
+      }
+      case 0x0142:
+      case 0x013A:
+      case 0x013C:
+      case 0x013E:
+      case 0x0140:
+      case 0x1E37:
+      case 0x1E3D: {
+         return L'l';
+      }
+      case 0x0272:
+      case 0x0149:
+      case 0x0144:
+      case 0x1E45:
+      case 0x0148:
+      case 0x00F1:
+      case 0x0146:
+      case 0x1E4B: {
+         return L'n';
+      }
+      case 0x01EB:
+      case 0x00F8:
+      case 0x01A1:
+      case 0x00F3:
+      case 0x00F2:
+      case 0x022F:
+      case 0x0231:
+      case 0x00F4:
+      case 0x00F6:
+      case 0x022B:
+      case 0x01D2:
+      case 0x014F:
+      case 0x014D:
+      case 0x00F5:
+      case 0x022D:
+      case 0x0151:
+      case 0x1ECD:
+      case 0x01FF: {
+         return L'o';
+      }
+      case 0x01A5:
+      {
+         return L'p';
+      }
+      case 0x024D:
+      case 0x0155:
+      case 0x0159:
+      case 0x0157:
+      case 0x1E5B: {
+         return L'r';
+      }
+      case 0x015F:
+      case 0x015B:
+      case 0x015D:
+      case 0x1E61:
+      case 0x0161:
+      case 0x0219:
+      case 0x1E63: {
+         return L's';
+      }
+      case 0x01AD:
+      case 0x0163:
+      case 0x0167:
+      case 0x0165:
+      case 0x021B:
+      case 0x1E6D:
+      case 0x1E71: {
+         return L't';
+      }
+      case 0x0173:
+      case 0x01B0:
+      case 0x0289:
+      case 0x00FA:
+      case 0x00F9:
+      case 0x00FB:
+      case 0x00FC:
+      case 0x01D4:
+      case 0x016D:
+      case 0x016B:
+      case 0x0169:
+      case 0x0171:
+      case 0x016F:
+      case 0x1EE5: {
+         return L'u';
+      }
+      case 0x1E83:
+      case 0x1E81:
+      case 0x0175:
+      case 0x1E85: {
+         return L'w';
+      }
+      case 0x1E8B: {
+         return L'x';
+      }
+      case 0x01B4:
+      case 0x00FD:
+      case 0x1EF3:
+      case 0x0177:
+      case 0x00FF:
+      case 0x0233:
+      case 0x1EF9: {
+         return L'y';
+      }
+      case 0x017A:
+      case 0x017C:
+      case 0x017E:
+      case 0x1E93: {
+         return L'z';
+      }
+      default: {
+         return isCombiningMark(ch)
+            ? TO_RAW_REMOVED
+            : static_cast<uint32_t>(ch);
+      }
    }
 }
 
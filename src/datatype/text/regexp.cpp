@@ -13,29 +13,860 @@
 */
 
 #include "../../../include/perun2/datatype/text/regexp.hpp"
+#include "../../../include/perun2/datatype/text/chars.hpp"
+#include <cwctype>
 
 
 namespace perun2::gen
 {
 
+static p_bool regexp_isWordChar(const p_char ch)
+{
+   return ch == CHAR_UNDERSCORE || std::iswalnum(ch);
+}
+
+// the dot of ECMAScript does not match line terminators
+static p_bool regexp_isLineTerminator(const p_char ch)
+{
+   switch (ch) {
+      case CHAR_NEW_LINE:
+      case CHAR_CARRIAGE_RETURN:
+      case L'\u2028':
+      case L'\u2029': {
+         return true;
+      }
+      default: {
+         return false;
+      }
+   }
+}
+
+
+p_bool RegexpClass::contains(const p_char ch) const
+{
+   p_bool result = (this->digits && std::iswdigit(ch))
+      || (this->nonDigits && !std::iswdigit(ch))
+      || (this->words && regexp_isWordChar(ch))
+      || (this->nonWords && !regexp_isWordChar(ch))
+      || (this->spaces && std::iswspace(ch))
+      || (this->nonSpaces && !std::iswspace(ch));
+
+   if (!result) {
+      for (const RegexpRange& range : this->ranges) {
+         if (ch >= range.first && ch <= range.last) {
+            result = true;
+            break;
+         }
+      }
+   }
+
+   return this->negated ? !result : result;
+}
+
+
+enum RegexpNodeType
+{
+   rn_Empty = 0,
+   rn_Char,
+   rn_Any,
+   rn_Class,
+   rn_Start,
+   rn_End,
+   rn_WordBoundary,
+   rn_NotWordBoundary,
+   rn_Concatenation,
+   rn_Alternation,
+   rn_Repetition
+};
+
+
+struct RegexpNode
+{
+   RegexpNodeType type = RegexpNodeType::rn_Empty;
+   p_char ch = CHAR_NULL;
+   p_size classId = 0;
+   p_size min = 0;
+   p_size max = 0;
+   std::vector<RegexpNode> children;
+};
+
+
+// recursive descent parser of the supported subset of ECMAScript regular expressions
+// any doubt ends with a failure, and then the pattern is left to std::wregex
+struct RegexpParser
+{
+public:
+   RegexpParser(const p_str& pat, std::vector<RegexpClass>& cls)
+      : pattern(pat), length(pat.size()), classes(cls) { };
+
+   p_bool parse(RegexpNode& result)
+   {
+      return this->parseAlternation(result) && this->index == this->length;
+   }
+
+private:
+   p_bool atEnd() const
+   {
+      return this->index >= this->length;
+   }
+
+   p_bool parseAlternation(RegexpNode& result)
+   {
+      RegexpNode first;
+      if (!this->parseConcatenation(first)) {
+         return false;
+      }
+
+      if (this->atEnd() || this->pattern[this->index] != REGEXP_ALTERNATION) {
+         result = std::move(first);
+         return true;
+      }
+
+      result.type = RegexpNodeType::rn_Alternation;
+      result.children.push_back(std::move(first));
+
+      while (!this->atEnd() && this->pattern[this->index] == REGEXP_ALTERNATION) {
+         this->index++;
+         RegexpNode next;
+         if (!this->parseConcatenation(next)) {
+            return false;
+         }
+         result.children.push_back(std::move(next));
+      }
+
+      return true;
+   }
+
+   p_bool parseConcatenation(RegexpNode& result)
+   {
+      result.type = RegexpNodeType::rn_Concatenation;
+
+      while (!this->atEnd()) {
+         const p_char ch = this->pattern[this->index];
+         if (ch == REGEXP_ALTERNATION || ch == REGEXP_GROUP_END) {
+            break;
+         }
+
+         RegexpNode next;
+         if (!this->parseRepetition(next)) {
+            return false;
+         }
+         result.children.push_back(std::move(next));
+      }
+
+      return true;
+   }
+
+   p_bool parseNumber(p_size& result)
+   {
+      const p_size start = this->index;
+      result = 0;
+
+      while (!this->atEnd() && this->pattern[this->index] >= CHAR_0 && this->pattern[this->index] <= CHAR_9) {
+         result = result * 10 + static_cast<p_size>(this->pattern[this->index] - CHAR_0);
+         if (result > REGEXP_MAX_REPEATS) {
+            return false;
+         }
+         this->index++;
+      }
+
+      return this->index != start;
+   }
+
+   p_bool parseQuantifier(p_size& min, p_size& max)
+   {
+      switch (this->pattern[this->index]) {
+         case REGEXP_ZERO_OR_MORE: {
+            min = 0;
+            max = REGEXP_INFINITY;
+            this->index++;
+            return true;
+         }
+         case REGEXP_ONE_OR_MORE: {
+            min = 1;
+            max = REGEXP_INFINITY;
+            this->index++;
+            return true;
+         }
+         case REGEXP_OPTIONAL: {
+            min = 0;
+            max = 1;
+            this->index++;
+            return true;
+         }
+         case REGEXP_REPEAT_START: {
+            this->index++;
+            if (!this->parseNumber(min) || this->atEnd()) {
+               return false;
+            }
+
+            if (this->pattern[this->index] == REGEXP_REPEAT_END) {
+               max = min;
+            }
+            else if (this->pattern[this->index] == REGEXP_REPEAT_SEPARATOR) {
+               this->index++;
+               if (this->atEnd()) {
+                  return false;
+               }
+
+               if (this->pattern[this->index] == REGEXP_REPEAT_END) {
+                  max = REGEXP_INFINITY;
+               }
+               else if (!this->parseNumber(max) || max < min) {
+                  return false;
+               }
+            }
+            else {
+               return false;
+            }
+
+            if (this->atEnd() || this->pattern[this->index] != REGEXP_REPEAT_END) {
+               return false;
+            }
+
+            this->index++;
+            return true;
+         }
+         default: {
+            return false;
+         }
+      }
+   }
+
+   static p_bool isQuantifier(const p_char ch)
+   {
+      return ch == REGEXP_ZERO_OR_MORE || ch == REGEXP_ONE_OR_MORE
+         || ch == REGEXP_OPTIONAL || ch == REGEXP_REPEAT_START;
+   }
+
+   p_bool parseRepetition(RegexpNode& result)
+   {
+      RegexpNode atom;
+      if (!this->parseAtom(atom)) {
+         return false;
+      }
+
+      if (this->atEnd() || !isQuantifier(this->pattern[this->index])) {
+         result = std::move(atom);
+         return true;
+      }
+
+      switch (atom.type) {
+         case RegexpNodeType::rn_Start:
+         case RegexpNodeType::rn_End:
+         case RegexpNodeType::rn_WordBoundary:
+         case RegexpNodeType::rn_NotWordBoundary: {
+            return false;
+         }
+         default: {
+            break;
+         }
+      }
+
+      result.type = RegexpNodeType::rn_Repetition;
+      if (!this->parseQuantifier(result.min, result.max)) {
+         return false;
+      }
+
+      // lazy quantifiers do not change the answer to whether there is a match
+      if (!this->atEnd() && this->pattern[this->index] == REGEXP_OPTIONAL) {
+         this->index++;
+      }
+
+      if (!this->atEnd() && isQuantifier(this->pattern[this->index])) {
+         return false;
+      }
+
+      result.children.push_back(std::move(atom));
+      return true;
+   }
+
+   p_bool parseAtom(RegexpNode& result)
+   {
+      const p_char ch = this->pattern[this->index];
+      this->index++;
+
+      switch (ch) {
+         case REGEXP_GROUP_START: {
+            if (!this->atEnd() && this->pattern[this->index] == REGEXP_OPTIONAL) {
+               if (this->index + 1 >= this->length || this->pattern[this->index + 1] != REGEXP_NON_CAPTURING) {
+                  return false;
+               }
+               this->index += 2;
+            }
+
+            if (!this->parseAlternation(result) || this->atEnd() || this->pattern[this->index] != REGEXP_GROUP_END) {
+               return false;
+            }
+
+            this->index++;
+            return true;
+         }
+         case REGEXP_CLASS_START: {
+            return this->parseClass(result);
+         }
+         case REGEXP_ANY: {
+            result.type = RegexpNodeType::rn_Any;
+            return true;
+         }
+         case REGEXP_START: {
+            result.type = RegexpNodeType::rn_Start;
+            return true;
+         }
+         case REGEXP_END: {
+            result.type = RegexpNodeType::rn_End;
+            return true;
+         }
+         case REGEXP_ESCAPE: {
+            return this->parseEscape(result);
+         }
+         case REGEXP_ZERO_OR_MORE:
+         case REGEXP_ONE_OR_MORE:
+         case REGEXP_OPTIONAL:
+         case REGEXP_REPEAT_START:
+         case REGEXP_REPEAT_END:
+         case REGEXP_CLASS_END:
+         case REGEXP_GROUP_END: {
+            return false;
+         }
+         default: {
+            result.type = RegexpNodeType::rn_Char;
+            result.ch = ch;
+            return true;
+         }
+      }
+   }
+
+   p_bool parseHex(const p_size digits, p_char& result)
+   {
+      if (this->index + digits > this->length) {
+         return false;
+      }
+
+      p_size value = 0;
+
+      for (p_size i = 0; i < digits; i++) {
+         const p_char ch = this->pattern[this->index];
+         value *= 16;
+
+         if (ch >= CHAR_0 && ch <= CHAR_9) {
+            value += static_cast<p_size>(ch - CHAR_0);
+         }
+         else if (ch >= CHAR_a && ch <= CHAR_f) {
+            value += static_cast<p_size>(ch - CHAR_a) + 10;
+         }
+         else if (ch >= CHAR_A && ch <= CHAR_F) {
+            value += static_cast<p_size>(ch - CHAR_A) + 10;
+         }
+         else {
+            return false;
+         }
+
+         this->index++;
+      }
+
+      result = static_cast<p_char>(value);
+      return true;
+   }
+
+   // escapes that stand for one character, valid both inside and outside of a class
+   p_bool parseCharEscape(const p_char ch, p_char& result)
+   {
+      switch (ch) {
+         case L'f': {
+            result = L'\f';
+            return true;
+         }
+         case L'n': {
+            result = L'\n';
+            return true;
+         }
+         case L'r': {
+            result = L'\r';
+            return true;
+         }
+         case L't': {
+            result = L'\t';
+            return true;
+         }
+         case L'v': {
+            result = L'\v';
+            return true;
+         }
+         case L'0': {
+            result = CHAR_NULL;
+            return this->atEnd() || !char_isDigit(this->pattern[this->index]);
+         }
+         case L'x': {
+            return this->parseHex(2, result);
+         }
+         case L'u': {
+            return this->parseHex(4, result);
+         }
+         default: {
+            // identity escapes of letters and digits are left to std::wregex
+            if (std::iswalnum(ch) || ch == CHAR_UNDERSCORE) {
+               return false;
+            }
+
+            result = ch;
+            return true;
+         }
+      }
+   }
+
+   // \d, \w, \s and their negations
+   static p_bool addClassEscape(const p_char ch, RegexpClass& cls)
+   {
+      switch (ch) {
+         case L'd': {
+            cls.digits = true;
+            return true;
+         }
+         case L'D': {
+            cls.nonDigits = true;
+            return true;
+         }
+         case L'w': {
+            cls.words = true;
+            return true;
+         }
+         case L'W': {
+            cls.nonWords = true;
+            return true;
+         }
+         case L's': {
+            cls.spaces = true;
+            return true;
+         }
+         case L'S': {
+            cls.nonSpaces = true;
+            return true;
+         }
+         default: {
+            return false;
+         }
+      }
+   }
+
+   p_bool parseEscape(RegexpNode& result)
+   {
+      if (this->atEnd()) {
+         return false;
+      }
+
+      const p_char ch = this->pattern[this->index];
+      this->index++;
+
+      switch (ch) {
+         case L'b': {
+            result.type = RegexpNodeType::rn_WordBoundary;
+            return true;
+         }
+         case L'B': {
+            result.type = RegexpNodeType::rn_NotWordBoundary;
+            return true;
+         }
+      }
+
+      RegexpClass cls;
+      if (addClassEscape(ch, cls)) {
+         result.type = RegexpNodeType::rn_Class;
+         result.classId = this->classes.size();
+         this->classes.push_back(cls);
+         return true;
+      }
+
+      result.type = RegexpNodeType::rn_Char;
+      return this->parseCharEscape(ch, result.ch);
+   }
+
+   p_bool parseClassChar(p_char& result, RegexpClass& cls, p_bool& isClassEscape)
+   {
+      isClassEscape = false;
+      const p_char ch = this->pattern[this->index];
+      this->index++;
+
+      if (ch != REGEXP_ESCAPE) {
+         result = ch;
+         return true;
+      }
+
+      if (this->atEnd()) {
+         return false;
+      }
+
+      const p_char esc = this->pattern[this->index];
+      this->index++;
+
+      if (addClassEscape(esc, cls)) {
+         isClassEscape = true;
+         return true;
+      }
+
+      // inside of a class, \b is the backspace
+      if (esc == L'b') {
+         result = L'\b';
+         return true;
+      }
+
+      return this->parseCharEscape(esc, result);
+   }
+
+   p_bool parseClass(RegexpNode& result)
+   {
+      RegexpClass cls;
+
+      if (!this->atEnd() && this->pattern[this->index] == REGEXP_CLASS_NEGATION) {
+         cls.negated = true;
+         this->index++;
+      }
+
+      // an empty class and a closing bracket at its start are treated differently by implementations
+      if (this->atEnd() || this->pattern[this->index] == REGEXP_CLASS_END) {
+         return false;
+      }
+
+      while (this->pattern[this->index] != REGEXP_CLASS_END) {
+         p_char first;
+         p_bool firstIsClass;
+         if (!this->parseClassChar(first, cls, firstIsClass) || this->atEnd()) {
+            return false;
+         }
+
+         if (this->pattern[this->index] == REGEXP_CLASS_RANGE
+            && this->index + 1 < this->length
+            && this->pattern[this->index + 1] != REGEXP_CLASS_END) 
+         {
+            this->index++;
+            p_char last;
+            p_bool lastIsClass;
+            if (firstIsClass || !this->parseClassChar(last, cls, lastIsClass) || lastIsClass || last < first) {
+               return false;
+            }
+            cls.ranges.push_back({ first, last });
+         }
+         else if (!firstIsClass) {
+            cls.ranges.push_back({ first, first });
+         }
+
+         if (this->atEnd()) {
+            return false;
+         }
+      }
+
+      this->index++;
+      result.type = RegexpNodeType::rn_Class;
+      result.classId = this->classes.size();
+      this->classes.push_back(cls);
+      return true;
+   }
+
+   const p_str& pattern;
+   const p_size length;
+   p_size index = 0;
+   std::vector<RegexpClass>& classes;
+};
+
+
+// emit instructions of the Thompson automaton
+static p_bool regexp_emit(const RegexpNode& node, std::vector<RegexpInstruction>& result)
+{
+   if (result.size() > REGEXP_MAX_INSTRUCTIONS) {
+      return false;
+   }
+
+   switch (node.type) {
+      case RegexpNodeType::rn_Empty: {
+         return true;
+      }
+      case RegexpNodeType::rn_Char: {
+         result.push_back({ RegexpOperation::ro_Char, node.ch, 0, 0 });
+         return true;
+      }
+      case RegexpNodeType::rn_Any: {
+         result.push_back({ RegexpOperation::ro_Any, CHAR_NULL, 0, 0 });
+         return true;
+      }
+      case RegexpNodeType::rn_Class: {
+         result.push_back({ RegexpOperation::ro_Class, CHAR_NULL, node.classId, 0 });
+         return true;
+      }
+      case RegexpNodeType::rn_Start: {
+         result.push_back({ RegexpOperation::ro_Start, CHAR_NULL, 0, 0 });
+         return true;
+      }
+      case RegexpNodeType::rn_End: {
+         result.push_back({ RegexpOperation::ro_End, CHAR_NULL, 0, 0 });
+         return true;
+      }
+      case RegexpNodeType::rn_WordBoundary: {
+         result.push_back({ RegexpOperation::ro_WordBoundary, CHAR_NULL, 0, 0 });
+         return true;
+      }
+      case RegexpNodeType::rn_NotWordBoundary: {
+         result.push_back({ RegexpOperation::ro_NotWordBoundary, CHAR_NULL, 0, 0 });
+         return true;
+      }
+      case RegexpNodeType::rn_Concatenation: {
+         for (const RegexpNode& child : node.children) {
+            if (!regexp_emit(child, result)) {
+               return false;
+            }
+         }
+         return true;
+      }
+      case RegexpNodeType::rn_Alternation: {
+         std::vector<p_size> jumps;
+         const p_size last = node.children.size() - 1;
+
+         for (p_size i = 0; i < last; i++) {
+            const p_size split = result.size();
+            result.push_back({ RegexpOperation::ro_Split, CHAR_NULL, split + 1, 0 });
+
+            if (!regexp_emit(node.children[i], result)) {
+               return false;
+            }
+
+            jumps.push_back(result.size());
+            result.push_back({ RegexpOperation::ro_Jump, CHAR_NULL, 0, 0 });
+            result[split].second = result.size();
+         }
+
+         if (!regexp_emit(node.children[last], result)) {
+            return false;
+         }
+
+         for (const p_size jump : jumps) {
+            result[jump].first = result.size();
+         }
+         return true;
+      }
+      case RegexpNodeType::rn_Repetition: {
+         const RegexpNode& child = node.children[0];
+
+         for (p_size i = 0; i < node.min; i++) {
+            if (!regexp_emit(child, result)) {
+               return false;
+            }
+         }
+
+         if (node.max == REGEXP_INFINITY) {
+            const p_size split = result.size();
+            result.push_back({ RegexpOperation::ro_Split, CHAR_NULL, split + 1, 0 });
+
+            if (!regexp_emit(child, result)) {
+               return false;
+            }
+
+            result.push_back({ RegexpOperation::ro_Jump, CHAR_NULL, split, 0 });
+            result[split].second = result.size();
+            return true;
+         }
+
+         std::vector<p_size> splits;
+
+         for (p_size i = node.min; i < node.max; i++) {
+            splits.push_back(result.size());
+            result.push_back({ RegexpOperation::ro_Split, CHAR_NULL, result.size() + 1, 0 });
+
+            if (!regexp_emit(child, result)) {
+               return false;
+            }
+         }
+
+         for (const p_size split : splits) {
+            result[split].second = result.size();
+         }
+         return true;
+      }
+   }
+
+   return false;
+}
+
+
+RegexpProgram::RegexpProgram(const p_str& pat)
+{
+   RegexpNode root;
+   RegexpParser parser(pat, this->classes);
+
+   if (parser.parse(root) && regexp_emit(root, this->instructions)
+      && this->instructions.size() < REGEXP_MAX_INSTRUCTIONS) 
+   {
+      this->instructions.push_back({ RegexpOperation::ro_Match, CHAR_NULL, 0, 0 });
+      this->anchored = this->instructions[0].operation == RegexpOperation::ro_Start;
+      this->visited.resize(this->instructions.size(), 0);
+      this->currentStates.reserve(this->instructions.size());
+      this->nextStates.reserve(this->instructions.size());
+      this->pending.reserve(this->instructions.size());
+   }
+   else {
+      this->instructions.clear();
+      this->classes.clear();
+      this->fallback = std::make_unique<std::wregex>(pat);
+   }
+}
+
+
+// follow the transitions that do not consume characters
+void RegexpProgram::addState(std::vector<p_size>& states, const p_size start, const p_str& value, const p_size position)
+{
+   this->pending.push_back(start);
+
+   while (!this->pending.empty()) {
+      const p_size id = this->pending.back();
+      this->pending.pop_back();
+
+      if (this->visited[id] == this->generation) {
+         continue;
+      }
+
+      this->visited[id] = this->generation;
+      const RegexpInstruction& instruction = this->instructions[id];
+
+      switch (instruction.operation) {
+         case RegexpOperation::ro_Jump: {
+            this->pending.push_back(instruction.first);
+            break;
+         }
+         case RegexpOperation::ro_Split: {
+            this->pending.push_back(instruction.second);
+            this->pending.push_back(instruction.first);
+            break;
+         }
+         case RegexpOperation::ro_Start: {
+            if (position == 0) {
+               this->pending.push_back(id + 1);
+            }
+            break;
+         }
+         case RegexpOperation::ro_End: {
+            if (position == value.size()) {
+               this->pending.push_back(id + 1);
+            }
+            break;
+         }
+         case RegexpOperation::ro_WordBoundary:
+         case RegexpOperation::ro_NotWordBoundary: {
+            const p_bool before = position > 0 && regexp_isWordChar(value[position - 1]);
+            const p_bool after = position < value.size() && regexp_isWordChar(value[position]);
+            const p_bool boundary = before != after;
+
+            if (boundary == (instruction.operation == RegexpOperation::ro_WordBoundary)) {
+               this->pending.push_back(id + 1);
+            }
+            break;
+         }
+         default: {
+            states.push_back(id);
+            break;
+         }
+      }
+   }
+}
+
+
+p_bool RegexpProgram::consumes(const RegexpInstruction& instruction, const p_char ch) const
+{
+   switch (instruction.operation) {
+      case RegexpOperation::ro_Char: {
+         return instruction.ch == ch;
+      }
+      case RegexpOperation::ro_Any: {
+         return !regexp_isLineTerminator(ch);
+      }
+      case RegexpOperation::ro_Class: {
+         return this->classes[instruction.first].contains(ch);
+      }
+      default: {
+         return false;
+      }
+   }
+}
+
+
+p_bool RegexpProgram::search(const p_str& value)
+{
+   if (this->fallback) {
+      return std::regex_search(value, *this->fallback);
+   }
+
+   const p_size length = value.size();
+   this->currentStates.clear();
+   this->generation++;
+
+   for (p_size position = 0; position <= length; position++) {
+      // a match can start anywhere
+      if (position == 0 || !this->anchored) {
+         this->addState(this->currentStates, 0, value, position);
+      }
+
+      for (const p_size id : this->currentStates) {
+         if (this->instructions[id].operation == RegexpOperation::ro_Match) {
+            return true;
+         }
+      }
+
+      if (position == length || (this->anchored && this->currentStates.empty())) {
+         break;
+      }
+
+      const p_char ch = value[position];
+      this->nextStates.clear();
+      this->generation++;
+
+      for (const p_size id : this->currentStates) {
+         if (this->consumes(this->instructions[id], ch)) {
+            this->addState(this->nextStates, id + 1, value, position + 1);
+         }
+      }
+
+      std::swap(this->currentStates, this->nextStates);
+   }
+
+   return false;
+}
+
+
+RegexpProgram& RegexpCache::get(const p_str& pattern)
+{
+   auto found = this->positions.find(pattern);
+
+   if (found != this->positions.end()) {
+      this->entries.splice(this->entries.begin(), this->entries, found->second);
+      return found->second->second;
+   }
+
+   if (this->entries.size() >= REGEXP_CACHE_SIZE) {
+      this->positions.erase(this->entries.back().first);
+      this->entries.pop_back();
+   }
+
+   this->entries.emplace_front(std::piecewise_construct, std::forward_as_tuple(pattern), std::forward_as_tuple(pattern));
+   this->positions.emplace(pattern, this->entries.begin());
+   return this->entries.front().second;
+}
+
+
 Regexp::Regexp(p_genptr<p_str>& val, p_genptr<p_str>& pat)
    : value(std::move(val)), pattern(std::move(pat)) { };
 
 
 p_bool Regexp::getValue()
 {
-   std::wregex pattern(this->pattern->getValue());
-   return std::regex_search(this->value->getValue(), pattern);
+   RegexpProgram& program = this->cache.get(this->pattern->getValue());
+   return program.search(this->value->getValue());
 }
 
 
 RegexpConst::RegexpConst(p_genptr<p_str>& val, const p_str& pat)
-   : value(std::move(val)), pattern(pat) { };
+   : value(std::move(val)), program(pat) { };
 
 
 p_bool RegexpConst::getValue()
 {
-   return std::regex_search(this->value->getValue(), this->pattern);
+   return this->program.search(this->value->getValue());
 }
 
 
@@ -22,11 +22,153 @@
 namespace perun2::gen
 {
 
-ResemblesConst::ResemblesConst(p_genptr<p_str>& val, const p_str& pat)
-   : value(std::move(val)), pattern(pat), mistakesAllowed(resemblanceMistakesAllowed(pat))
+ResemblancePattern::ResemblancePattern(const p_str& pat)
+   : pattern(pat)
 {
    prepareForResemblance(this->pattern);
-};
+   this->length = this->pattern.size();
+
+   if (this->length == 0 || this->length > RESEMBLANCE_MAX_BIT_LENGTH) {
+      this->rows.resize(3 * (this->length + 1));
+      return;
+   }
+
+   this->asciiMasks.resize(RESEMBLANCE_ASCII_END, 0);
+
+   for (p_size i = 0; i < this->length; i++) {
+      const p_char ch = this->pattern[i];
+      const uint64_t bit = static_cast<uint64_t>(1) << i;
+
+      if (static_cast<p_size>(ch) < RESEMBLANCE_ASCII_END) {
+         this->asciiMasks[static_cast<p_size>(ch)] |= bit;
+      }
+      else {
+         this->otherMasks[ch] |= bit;
+      }
+   }
+}
+
+
+p_size ResemblancePattern::size() const
+{
+   return this->length;
+}
+
+
+p_int ResemblancePattern::distance(const p_str& value, const p_int limit)
+{
+   return this->length == 0 || this->length > RESEMBLANCE_MAX_BIT_LENGTH
+      ? this->tableDistance(value, limit)
+      : this->bitDistance(value, limit);
+}
+
+
+uint64_t ResemblancePattern::getMask(const p_char ch) const
+{
+   if (static_cast<p_size>(ch) < RESEMBLANCE_ASCII_END) {
+      return this->asciiMasks[static_cast<p_size>(ch)];
+   }
+
+   const auto found = this->otherMasks.find(ch);
+   return found == this->otherMasks.end()
+      ? 0
+      : found->second;
+}
+
+
+// bits of the vertical differences of the last column are kept in two words
+// the score is the value at the bottom of the column
+// a substring can start anywhere, so the top row is always zero
+p_int ResemblancePattern::bitDistance(const p_str& value, const p_int limit) const
+{
+   const uint64_t last = static_cast<uint64_t>(1) << (this->length - 1);
+   uint64_t positive = ~static_cast<uint64_t>(0);
+   uint64_t negative = 0;
+   uint64_t prevMatches = 0;
+   uint64_t prevZeros = 0;
+   p_int score = static_cast<p_int>(this->length);
+   p_int minimum = score;
+
+   for (const p_char ch : value) {
+      const uint64_t matches = this->getMask(ch);
+      const uint64_t transpositions = (((~prevZeros) & matches) << 1) & prevMatches;
+      const uint64_t zeros = (((matches & positive) + positive) ^ positive) | matches | negative | transpositions;
+      uint64_t horizontalPositive = negative | ~(zeros | positive);
+      uint64_t horizontalNegative = zeros & positive;
+
+      if (horizontalPositive & last) {
+         score++;
+      }
+      else if (horizontalNegative & last) {
+         score--;
+      }
+
+      horizontalPositive <<= 1;
+      horizontalNegative <<= 1;
+      positive = horizontalNegative | ~(zeros | horizontalPositive);
+      negative = zeros & horizontalPositive;
+      prevMatches = matches;
+      prevZeros = zeros;
+
+      if (score < minimum) {
+         minimum = score;
+         if (minimum <= limit) {
+            break;
+         }
+      }
+   }
+
+   return minimum;
+}
+
+
+p_int ResemblancePattern::tableDistance(const p_str& value, const p_int limit)
+{
+   const p_size width = this->length + 1;
+   p_int* beforePrev = &this->rows[0];
+   p_int* prev = &this->rows[width];
+   p_int* current = &this->rows[2 * width];
+
+   for (p_size j = 0; j < width; j++) {
+      prev[j] = static_cast<p_int>(j);
+   }
+
+   p_int minimum = prev[this->length];
+
+   for (p_size i = 1; i <= value.size(); i++) {
+      current[0] = 0;
+
+      for (p_size j = 1; j < width; j++) {
+         current[j] = perun2::langutil::minimum(
+            prev[j] + 1,
+            current[j - 1] + 1,
+            prev[j - 1] + (value[i - 1] == this->pattern[j - 1] ? 0 : 1)
+         );
+
+         if (i > 1 && j > 1 && value[i - 1] == this->pattern[j - 2] && value[i - 2] == this->pattern[j - 1]) {
+            current[j] = perun2::langutil::minimum(current[j], beforePrev[j - 2] + 1);
+         }
+      }
+
+      if (current[this->length] < minimum) {
+         minimum = current[this->length];
+         if (minimum <= limit) {
+            break;
+         }
+      }
+
+      p_int* const oldest = beforePrev;
+      beforePrev = prev;
+      prev = current;
+      current = oldest;
+   }
+
+   return minimum;
+}
+
+
+ResemblesConst::ResemblesConst(p_genptr<p_str>& val, const p_str& pat)
+   : value(std::move(val)), pattern(pat), mistakesAllowed(resemblanceMistakesAllowed(pat)) { };
 
 
 p_bool ResemblesConst::getValue()
@@ -38,18 +180,7 @@ p_bool ResemblesConst::getValue()
       return false;
    }
 
-   const p_int limit = 1 + static_cast<p_int>(v.size()) - static_cast<p_int>(pattern.size()) + mistakesAllowed;
-
-   for (p_int i = 0; i < limit; i++)
-   {
-      const p_str chunk = v.substr(i);
-      const p_int mistakes = multiDamerauLevenshteinDistance(chunk, pattern);
-      if (mistakes <= mistakesAllowed) {
-         return true;
-      }
-   }
-
-   return false;
+   return this->pattern.distance(v, this->mistakesAllowed) <= this->mistakesAllowed;
 };
 
 
@@ -57,35 +188,29 @@ Resembles::Resembles(p_genptr<p_str>& val, p_genptr<p_str>& pat)
    : value(std::move(val)), pattern(std::move(pat)) { };
 
 
+// the pattern is prepared again only if it differs from the previous one
 p_bool Resembles::getValue()
 {
    p_str v = this->value->getValue();
-   p_str p = this->pattern->getValue();
+   const p_str p = this->pattern->getValue();
 
-   prepareForResemblance(v);
-   prepareForResemblance(p);
+   if (!this->prepared || p != this->prevPattern) {
+      this->prepared = std::make_unique<ResemblancePattern>(p);
+      this->prevPattern = p;
+   }
 
-   if (p.empty()) {
+   if (this->prepared->size() == 0) {
       return true;
    }
 
+   prepareForResemblance(v);
+
    if (v.empty()) {
       return false;
    }
 
-   const p_int mistakesAllowed = resemblanceMistakesAllowed(p);
-   const p_int limit = 1 + static_cast<p_int>(v.size()) - static_cast<p_int>(p.size()) + mistakesAllowed;
-
-   for (p_int i = 0; i < limit; i++)
-   {
-      const p_str chunk = v.substr(i);
-      const p_int mistakes = multiDamerauLevenshteinDistance(chunk, p);
-      if (mistakes <= mistakesAllowed) {
-         return true;
-      }
-   }
-
-   return false;
+   const p_int mistakesAllowed = static_cast<p_int>(this->prepared->size()) / RESEMBLANCE_MISTAKES_ALLOWED;
+   return this->prepared->distance(v, mistakesAllowed) <= mistakesAllowed;
 };
 
 
@@ -96,9 +221,9 @@ void prepareForResemblance(p_str& value)
 }
 
 
-p_ndouble str_resemblance(const p_str& value, const p_str& pattern)
+p_ndouble str_resemblance(const p_str& value, ResemblancePattern& pattern)
 {
-   if (pattern.empty()) {
+   if (pattern.size() == 0) {
       return NDOUBLE_ONE;
    }
 
@@ -106,63 +231,11 @@ p_ndouble str_resemblance(const p_str& value, const p_str& pattern)
       return NDOUBLE_ZERO;
    }
 
-   p_int minimum = MAX_P_INT;
-
-   for (p_size i = 0; i < value.size(); i++) 
-   {
-      const p_str chunk = value.substr(i);
-      const p_int next = multiDamerauLevenshteinDistance(chunk, pattern);
-      if (next < minimum) {
-         minimum = next;
-      }
-   }
-   
+   const p_int minimum = pattern.distance(value, -1);
    return NDOUBLE_ONE - (static_cast<p_ndouble>(minimum) / static_cast<p_ndouble>(pattern.size()));
 }
 
 
-static p_int multiDamerauLevenshteinDistance(const p_str& str1, const p_str& str2)
-{
-   const p_size len1 = str1.length();
-   const p_size len2 = str2.length();
-
-   std::vector<std::vector<p_int>> dp(len1 + 1, std::vector<p_int>(len2 + 1, 0));
-
-   for (p_size i = 0; i <= len1; i++) {
-      dp[i][0] = i;
-   }
-
-   for (p_size j = 0; j <= len2; j++) {
-      dp[0][j] = j;
-   }
-
-   for (p_size i = 1; i <= len1; i++) {
-      for (p_size j = 1; j <= len2; j++) {
-         dp[i][j] = perun2::langutil::minimum(
-            dp[i - 1][j] + 1,
-            dp[i][j - 1] + 1,
-            dp[i - 1][j - 1] + (str1[i - 1] == str2[j - 1] ? 0 : 1)
-         );
-
-         if (i > 1 && j > 1 && str1[i - 1] == str2[j - 2] && str1[i - 2] == str2[j - 1]) {
-            dp[i][j] = perun2::langutil::minimum(dp[i][j], dp[i - 2][j - 2] + 1);
-         }
-      }
-   }
-
-   p_int min = dp[0][len2];
-
-   for (p_size i = 1; i <= len1; i++) {
-      p_int nv = dp[i][len2];
-      if (nv < min) {
-         min = nv;
-      }
-   }
-
-   return min;
-}
-
-
 static p_int resemblanceMistakesAllowed(const p_str& pattern)
 {
    return static_cast<p_int>(pattern.size()) / RESEMBLANCE_MISTAKES_ALLOWED;
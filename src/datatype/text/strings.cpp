@@ -215,44 +215,4 @@ const p_list STRINGS_VARS_IMMUTABLES =
    STRING_VIDEOS, STRING_RECURSIVEVIDEOS, STRING_IMAGES, STRING_RECURSIVEIMAGES
 };
 
-const p_list STRINGS_FUNC_BOO_STR = 
-{
-   STRING_ISLOWER, STRING_ISUPPER, STRING_ISNUMBER,
-   STRING_ISLETTER, STRING_ISDIGIT, STRING_ISBINARY, STRING_ISHEX
-};
-
-const p_list STRINGS_FUNC_NUM_NUM = 
-{
-   STRING_ABSOLUTE, STRING_CEIL, STRING_FLOOR,
-   STRING_ROUND, STRING_SIGN, STRING_SQRT, STRING_TRUNCATE
-};
-
-const p_list STRINGS_AGGRFUNC = 
-{
-   STRING_AVERAGE, STRING_SUM, STRING_MIN, STRING_MAX, STRING_MEDIAN
-};
-
-const p_list STRINGS_FUNC_STR_STR = 
-{
-   STRING_DIGITS,  STRING_LETTERS, STRING_LOWER, STRING_TRIM,
-   STRING_UPPER, STRING_REVERSE, STRING_AFTERDIGITS, STRING_AFTERLETTERS,
-   STRING_BEFOREDIGITS, STRING_BEFORELETTERS, STRING_CAPITALIZE, STRING_PARENT,
-   STRING_RAW
-};
-
-const p_list STRINGS_FUNC_STR_STR_NUM = 
-{
-   STRING_REPEAT, STRING_LEFT, STRING_RIGHT, STRING_FILL
-};
-
-const p_list STRINGS_FUNC_STR_NUM = 
-{
-   STRING_ROMAN, STRING_BINARY, STRING_HEX
-};
-
-const p_list STRINGS_FUNC_TIM_NUM = 
-{
-   STRING_CHRISTMAS, STRING_EASTER, STRING_NEWYEAR
-};
-
 }
@@ -22,6 +22,20 @@ namespace perun2
 {
 
 
+// the masks of all ASCII characters are made for every pattern
+// so ASCII letters are folded here, without the locale of the system
+static p_bool wildcard_areEqual(const p_char ch1, const p_char ch2)
+{
+   if (static_cast<p_size>(ch1) >= WILDCARD_ASCII_END || static_cast<p_size>(ch2) >= WILDCARD_ASCII_END) {
+      return os_areEqualInPath(ch1, ch2);
+   }
+
+   const p_char lower1 = (ch1 >= CHAR_A && ch1 <= CHAR_Z) ? (ch1 - CHAR_A + CHAR_a) : ch1;
+   const p_char lower2 = (ch2 >= CHAR_A && ch2 <= CHAR_Z) ? (ch2 - CHAR_A + CHAR_a) : ch2;
+   return lower1 == lower2;
+}
+
+
 WildcardComparer::WildcardComparer(const p_str& pat)
    : pattern(pat), patternLength(pat.size()) { };
 
@@ -32,6 +46,10 @@ p_bool WildcardComparer::matches(const p_str& val)
       return false;
    }
 
+   if (this->bitParallel) {
+      return this->matchesBits(val);
+   }
+
    this->valuePtr = &val;
    this->clearCharStates();
    return this->checkState(val.size(), this->patternLength) == Logic::True;
@@ -66,8 +84,150 @@ void WildcardComparer::clearCharStates()
 }
 
 
+p_bool WildcardComparer::canJumpOver(const p_size index) const
+{
+   return false;
+}
+
+
+void WildcardComparer::compileBits(const p_size start)
+{
+   if (this->patternLength > WILDCARD_MAX_BIT_ELEMENTS || start > this->patternLength) {
+      return;
+   }
+
+   this->bitParallel = true;
+   this->bitStart = start;
+   this->startBits = static_cast<uint64_t>(1) << start;
+   this->finalBit = static_cast<uint64_t>(1) << this->patternLength;
+   this->elements.reserve(this->patternLength);
+
+   for (p_size i = 0; i < this->patternLength; i++) {
+      const WildcardElement element = this->getElement(i);
+      this->elements.push_back(element);
+
+      if (element != WildcardElement::we_Literal) {
+         this->emptyBits |= static_cast<uint64_t>(1) << i;
+
+         if (i > 0 && this->canJumpOver(i)) {
+            this->jumpBits |= static_cast<uint64_t>(1) << (i - 1);
+         }
+      }
+   }
+
+   this->asciiMasks.resize(WILDCARD_ASCII_END);
+
+   for (p_size i = 0; i < WILDCARD_ASCII_END; i++) {
+      this->makeMasks(static_cast<p_char>(i), this->asciiMasks[i]);
+   }
+}
+
+
+void WildcardComparer::makeMasks(const p_char ch, WildcardMasks& masks) const
+{
+   masks.steps = 0;
+   masks.loops = 0;
+
+   // the characters before the start are not compared, so nothing consumes there
+   for (p_size i = 0; i < this->patternLength; i++) {
+      if (i < this->bitStart && this->elements[i] != WildcardElement::we_Literal) {
+         continue;
+      }
+
+      switch (this->elements[i]) {
+         case WildcardElement::we_Literal: {
+            if (wildcard_areEqual(this->pattern[i], ch)) {
+               masks.steps |= static_cast<uint64_t>(1) << i;
+            }
+            break;
+         }
+         case WildcardElement::we_AnyChars: {
+            masks.loops |= static_cast<uint64_t>(1) << (i + 1);
+            break;
+         }
+         case WildcardElement::we_NonSeparatorChars: {
+            if (ch != OS_SEPARATOR) {
+               masks.loops |= static_cast<uint64_t>(1) << (i + 1);
+            }
+            break;
+         }
+         case WildcardElement::we_DigitsAndDots: {
+            if (ch == CHAR_DOT || (ch >= CHAR_0 && ch <= CHAR_9)) {
+               masks.loops |= static_cast<uint64_t>(1) << (i + 1);
+            }
+            break;
+         }
+      }
+   }
+}
+
+
+const WildcardMasks& WildcardComparer::getMasks(const p_char ch)
+{
+   if (static_cast<p_size>(ch) < WILDCARD_ASCII_END) {
+      return this->asciiMasks[static_cast<p_size>(ch)];
+   }
+
+   auto found = this->otherMasks.find(ch);
+
+   if (found == this->otherMasks.end()) {
+      WildcardMasks masks;
+      this->makeMasks(ch, masks);
+      found = this->otherMasks.emplace(ch, masks).first;
+   }
+
+   return found->second;
+}
+
+
+// add positions reachable without consuming any character
+uint64_t WildcardComparer::closeBits(uint64_t bits, const p_bool jumps) const
+{
+   uint64_t prev;
+
+   do {
+      prev = bits;
+      bits |= (bits & this->emptyBits) << 1;
+
+      if (jumps) {
+         bits |= (bits & this->jumpBits) << 2;
+      }
+   }
+   while (bits != prev);
+
+   return bits;
+}
+
+
+// Shift-And with self loops for sequences of characters
+p_bool WildcardComparer::matchesBits(const p_str& val)
+{
+   const p_size length = val.size();
+
+   if (length < this->bitStart) {
+      return false;
+   }
+
+   uint64_t bits = this->closeBits(this->startBits, this->bitStart > 0);
+
+   for (p_size i = this->bitStart; i < length; i++) {
+      const WildcardMasks& masks = this->getMasks(val[i]);
+      bits = this->closeBits(((bits & masks.steps) << 1) | (bits & masks.loops), true);
+
+      if (bits == 0) {
+         return false;
+      }
+   }
+
+   return (bits & this->finalBit) != 0;
+}
+
+
 SimpleWildcardComparer::SimpleWildcardComparer(const p_str& pat)
-   : WildcardComparer(pat) { };
+   : WildcardComparer(pat) 
+{ 
+   this->compileBits(0);
+};
 
 
 p_size SimpleWildcardComparer::getMinLength(const p_str& pat) const
@@ -116,4 +276,12 @@ Logic SimpleWildcardComparer::checkState(const p_size n, const p_size m)
    return ans;
 }
 
+
+WildcardElement SimpleWildcardComparer::getElement(const p_size index) const
+{
+   return this->pattern[index] == CHAR_ASTERISK
+      ? WildcardElement::we_AnyChars
+      : WildcardElement::we_Literal;
+}
+
 }
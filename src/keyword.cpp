@@ -15,114 +15,351 @@
 #include "../include/perun2/keyword.hpp"
 #include "../include/perun2/datatype/text/strings.hpp"
 #include "../include/perun2/perun2.hpp"
+#include <cstdint>
 
 
 namespace perun2
 {
 
-KeywordsData::KeywordsData() : KEYWORDS( 
+struct WordEntry
+{
+   p_strv word;
+   WordKind kind;
+   p_int value;
+};
+
+
+p_constexpr WordEntry WORD_ENTRIES[] =
 {
    // core commands:
-   { STRING_COPY, Keyword::kw_Copy },
-   { STRING_CREATE, Keyword::kw_Create },
-   { STRING_CREATEFILE, Keyword::kw_CreateFile },
-   { STRING_CREATEDIRECTORY, Keyword::kw_CreateDirectory },
-   { STRING_CREATEFILES, Keyword::kw_CreateFiles },
-   { STRING_CREATEDIRECTORIES, Keyword::kw_CreateDirectories },
-   { STRING_DELETE, Keyword::kw_Delete },
-   { STRING_DROP, Keyword::kw_Drop },
-   { STRING_HIDE, Keyword::kw_Hide },
-   { STRING_LOCK, Keyword::kw_Lock },
-   { STRING_MOVE, Keyword::kw_Move },
-   { STRING_OPEN, Keyword::kw_Open },
-   { STRING_REACCESS, Keyword::kw_Reaccess },
-   { STRING_RECREATE, Keyword::kw_Recreate },
-   { STRING_RECHANGE, Keyword::kw_Rechange },
-   { STRING_REMODIFY, Keyword::kw_Remodify },
-   { STRING_RENAME, Keyword::kw_Rename },
-   { STRING_SELECT, Keyword::kw_Select },
-   { STRING_UNHIDE, Keyword::kw_Unhide },
-   { STRING_UNLOCK, Keyword::kw_Unlock },
+   { STRING_COPY, WordKind::wk_Keyword, Keyword::kw_Copy },
+   { STRING_CREATE, WordKind::wk_Keyword, Keyword::kw_Create },
+   { STRING_CREATEFILE, WordKind::wk_Keyword, Keyword::kw_CreateFile },
+   { STRING_CREATEDIRECTORY, WordKind::wk_Keyword, Keyword::kw_CreateDirectory },
+   { STRING_CREATEFILES, WordKind::wk_Keyword, Keyword::kw_CreateFiles },
+   { STRING_CREATEDIRECTORIES, WordKind::wk_Keyword, Keyword::kw_CreateDirectories },
+   { STRING_DELETE, WordKind::wk_Keyword, Keyword::kw_Delete },
+   { STRING_DROP, WordKind::wk_Keyword, Keyword::kw_Drop },
+   { STRING_HIDE, WordKind::wk_Keyword, Keyword::kw_Hide },
+   { STRING_LOCK, WordKind::wk_Keyword, Keyword::kw_Lock },
+   { STRING_MOVE, WordKind::wk_Keyword, Keyword::kw_Move },
+   { STRING_OPEN, WordKind::wk_Keyword, Keyword::kw_Open },
+   { STRING_REACCESS, WordKind::wk_Keyword, Keyword::kw_Reaccess },
+   { STRING_RECREATE, WordKind::wk_Keyword, Keyword::kw_Recreate },
+   { STRING_RECHANGE, WordKind::wk_Keyword, Keyword::kw_Rechange },
+   { STRING_REMODIFY, WordKind::wk_Keyword, Keyword::kw_Remodify },
+   { STRING_RENAME, WordKind::wk_Keyword, Keyword::kw_Rename },
+   { STRING_SELECT, WordKind::wk_Keyword, Keyword::kw_Select },
+   { STRING_UNHIDE, WordKind::wk_Keyword, Keyword::kw_Unhide },
+   { STRING_UNLOCK, WordKind::wk_Keyword, Keyword::kw_Unlock },
    // core command flags:
-   { STRING_FORCE, Keyword::kw_Force },
-   { STRING_STACK, Keyword::kw_Stack },
+   { STRING_FORCE, WordKind::wk_Keyword, Keyword::kw_Force },
+   { STRING_STACK, WordKind::wk_Keyword, Keyword::kw_Stack },
    // logic:
-   { STRING_TRUE, Keyword::kw_True },
-   { STRING_FALSE, Keyword::kw_False },
-   { STRING_AND, Keyword::kw_And },
-   { STRING_OR, Keyword::kw_Or },
-   { STRING_XOR, Keyword::kw_Xor },
-   { STRING_NOT, Keyword::kw_Not },
+   { STRING_TRUE, WordKind::wk_Keyword, Keyword::kw_True },
+   { STRING_FALSE, WordKind::wk_Keyword, Keyword::kw_False },
+   { STRING_AND, WordKind::wk_Keyword, Keyword::kw_And },
+   { STRING_OR, WordKind::wk_Keyword, Keyword::kw_Or },
+   { STRING_XOR, WordKind::wk_Keyword, Keyword::kw_Xor },
+   { STRING_NOT, WordKind::wk_Keyword, Keyword::kw_Not },
    // other commands:
-   { STRING_PRINT, Keyword::kw_Print },
-   { STRING_RUN, Keyword::kw_Run },
-   { STRING_SLEEP, Keyword::kw_Sleep },
-   { STRING_POPUP, Keyword::kw_Popup },
-   { STRING_PYTHON, Keyword::kw_Python },
-   { STRING_PYTHON3, Keyword::kw_Python3 },
-   { STRING_EXECUTE, Keyword::kw_Execute },
+   { STRING_PRINT, WordKind::wk_Keyword, Keyword::kw_Print },
+   { STRING_RUN, WordKind::wk_Keyword, Keyword::kw_Run },
+   { STRING_SLEEP, WordKind::wk_Keyword, Keyword::kw_Sleep },
+   { STRING_POPUP, WordKind::wk_Keyword, Keyword::kw_Popup },
+   { STRING_PYTHON, WordKind::wk_Keyword, Keyword::kw_Python },
+   { STRING_PYTHON3, WordKind::wk_Keyword, Keyword::kw_Python3 },
+   { STRING_EXECUTE, WordKind::wk_Keyword, Keyword::kw_Execute },
    // expression elements:
-   { STRING_IN, Keyword::kw_In },
-   { STRING_LIKE, Keyword::kw_Like },
-   { STRING_RESEMBLES, Keyword::kw_Resembles },
-   { STRING_BETWEEN, Keyword::kw_Between },
-   { STRING_REGEXP, Keyword::kw_Regexp },
+   { STRING_IN, WordKind::wk_Keyword, Keyword::kw_In },
+   { STRING_LIKE, WordKind::wk_Keyword, Keyword::kw_Like },
+   { STRING_RESEMBLES, WordKind::wk_Keyword, Keyword::kw_Resembles },
+   { STRING_BETWEEN, WordKind::wk_Keyword, Keyword::kw_Between },
+   { STRING_REGEXP, WordKind::wk_Keyword, Keyword::kw_Regexp },
    // command structs:
-   { STRING_ELSE, Keyword::kw_Else },
-   { STRING_IF, Keyword::kw_If },
-   { STRING_INSIDE, Keyword::kw_Inside },
-   { STRING_TIMES, Keyword::kw_Times },
-   { STRING_WHILE, Keyword::kw_While },
-   { STRING_FOREACH, Keyword::kw_Foreach },
+   { STRING_ELSE, WordKind::wk_Keyword, Keyword::kw_Else },
+   { STRING_IF, WordKind::wk_Keyword, Keyword::kw_If },
+   { STRING_INSIDE, WordKind::wk_Keyword, Keyword::kw_Inside },
+   { STRING_TIMES, WordKind::wk_Keyword, Keyword::kw_Times },
+   { STRING_WHILE, WordKind::wk_Keyword, Keyword::kw_While },
+   { STRING_FOREACH, WordKind::wk_Keyword, Keyword::kw_Foreach },
    // filthers:
-   { STRING_EVERY, Keyword::kw_Every },
-   { STRING_FINAL, Keyword::kw_Final },
-   { STRING_LIMIT, Keyword::kw_Limit },
-   { STRING_ORDER, Keyword::kw_Order },
-   { STRING_SKIP, Keyword::kw_Skip },
-   { STRING_WHERE, Keyword::kw_Where },
+   { STRING_EVERY, WordKind::wk_Keyword, Keyword::kw_Every },
+   { STRING_FINAL, WordKind::wk_Keyword, Keyword::kw_Final },
+   { STRING_LIMIT, WordKind::wk_Keyword, Keyword::kw_Limit },
+   { STRING_ORDER, WordKind::wk_Keyword, Keyword::kw_Order },
+   { STRING_SKIP, WordKind::wk_Keyword, Keyword::kw_Skip },
+   { STRING_WHERE, WordKind::wk_Keyword, Keyword::kw_Where },
    // rest:
-   { STRING_AS, Keyword::kw_As },
-   { STRING_BY, Keyword::kw_By },
-   { STRING_TO, Keyword::kw_To },
-   { STRING_EXTENSIONLESS, Keyword::kw_Extensionless },
-   { STRING_WITH, Keyword::kw_With },
-   { STRING_FROM, Keyword::kw_From },
+   { STRING_AS, WordKind::wk_Keyword, Keyword::kw_As },
+   { STRING_BY, WordKind::wk_Keyword, Keyword::kw_By },
+   { STRING_TO, WordKind::wk_Keyword, Keyword::kw_To },
+   { STRING_EXTENSIONLESS, WordKind::wk_Keyword, Keyword::kw_Extensionless },
+   { STRING_WITH, WordKind::wk_Keyword, Keyword::kw_With },
+   { STRING_FROM, WordKind::wk_Keyword, Keyword::kw_From },
    // order:
-   { STRING_ASC, Keyword::kw_Asc },
-   { STRING_DESC, Keyword::kw_Desc },
+   { STRING_ASC, WordKind::wk_Keyword, Keyword::kw_Asc },
+   { STRING_DESC, WordKind::wk_Keyword, Keyword::kw_Desc },
    // one-word command:
-   { STRING_BREAK, Keyword::kw_Break },
-   { STRING_CONTINUE, Keyword::kw_Continue },
-   { STRING_EXIT, Keyword::kw_Exit },
-   { STRING_ERROR, Keyword::kw_Error }
-}),
-
-MONTHS({
-   { STRING_JANUARY,    TNUM_JANUARY },
-   { STRING_FEBRUARY,   TNUM_FEBRUARY },
-   { STRING_MARCH,      TNUM_MARCH },
-   { STRING_APRIL,      TNUM_APRIL },
-   { STRING_MAY,        TNUM_MAY },
-   { STRING_JUNE,       TNUM_JUNE },
-   { STRING_JULY,       TNUM_JULY },
-   { STRING_AUGUST,     TNUM_AUGUST },
-   { STRING_SEPTEMBER,  TNUM_SEPTEMBER },
-   { STRING_OCTOBER,    TNUM_OCTOBER },
-   { STRING_NOVEMBER,   TNUM_NOVEMBER },
-   { STRING_DECEMBER,   TNUM_DECEMBER }
-}),
-
-WEEKDAYS({
-   { STRING_MONDAY,     TNUM_MONDAY },
-   { STRING_TUESDAY,    TNUM_TUESDAY },
-   { STRING_WEDNESDAY,  TNUM_WEDNESDAY },
-   { STRING_THURSDAY,   TNUM_THURSDAY },
-   { STRING_FRIDAY,     TNUM_FRIDAY },
-   { STRING_SATURDAY,   TNUM_SATURDAY },
-   { STRING_SUNDAY,     TNUM_SUNDAY }
-})
-
-{ };
+   { STRING_BREAK, WordKind::wk_Keyword, Keyword::kw_Break },
+   { STRING_CONTINUE, WordKind::wk_Keyword, Keyword::kw_Continue },
+   { STRING_EXIT, WordKind::wk_Keyword, Keyword::kw_Exit },
+   { STRING_ERROR, WordKind::wk_Keyword, Keyword::kw_Error },
+
+   // months:
+   { STRING_JANUARY, WordKind::wk_Month, TNUM_JANUARY },
+   { STRING_FEBRUARY, WordKind::wk_Month, TNUM_FEBRUARY },
+   { STRING_MARCH, WordKind::wk_Month, TNUM_MARCH },
+   { STRING_APRIL, WordKind::wk_Month, TNUM_APRIL },
+   { STRING_MAY, WordKind::wk_Month, TNUM_MAY },
+   { STRING_JUNE, WordKind::wk_Month, TNUM_JUNE },
+   { STRING_JULY, WordKind::wk_Month, TNUM_JULY },
+   { STRING_AUGUST, WordKind::wk_Month, TNUM_AUGUST },
+   { STRING_SEPTEMBER, WordKind::wk_Month, TNUM_SEPTEMBER },
+   { STRING_OCTOBER, WordKind::wk_Month, TNUM_OCTOBER },
+   { STRING_NOVEMBER, WordKind::wk_Month, TNUM_NOVEMBER },
+   { STRING_DECEMBER, WordKind::wk_Month, TNUM_DECEMBER },
+
+   // weekdays:
+   { STRING_MONDAY, WordKind::wk_WeekDay, TNUM_MONDAY },
+   { STRING_TUESDAY, WordKind::wk_WeekDay, TNUM_TUESDAY },
+   { STRING_WEDNESDAY, WordKind::wk_WeekDay, TNUM_WEDNESDAY },
+   { STRING_THURSDAY, WordKind::wk_WeekDay, TNUM_THURSDAY },
+   { STRING_FRIDAY, WordKind::wk_WeekDay, TNUM_FRIDAY },
+   { STRING_SATURDAY, WordKind::wk_WeekDay, TNUM_SATURDAY },
+   { STRING_SUNDAY, WordKind::wk_WeekDay, TNUM_SUNDAY },
+
+   // boolean functions:
+   { STRING_ISLOWER, WordKind::wk_Function, Function::fn_IsLower },
+   { STRING_ISUPPER, WordKind::wk_Function, Function::fn_IsUpper },
+   { STRING_ISNUMBER, WordKind::wk_Function, Function::fn_IsNumber },
+   { STRING_ISLETTER, WordKind::wk_Function, Function::fn_IsLetter },
+   { STRING_ISDIGIT, WordKind::wk_Function, Function::fn_IsDigit },
+   { STRING_ISBINARY, WordKind::wk_Function, Function::fn_IsBinary },
+   { STRING_ISHEX, WordKind::wk_Function, Function::fn_IsHex },
+   { STRING_EXISTINSIDE, WordKind::wk_Function, Function::fn_ExistInside },
+   { STRING_ANYINSIDE, WordKind::wk_Function, Function::fn_AnyInside },
+   { STRING_ANY, WordKind::wk_Function, Function::fn_Any },
+   { STRING_EXIST, WordKind::wk_Function, Function::fn_Exist },
+   { STRING_EXISTS, WordKind::wk_Function, Function::fn_Exists },
+   { STRING_CONTAINS, WordKind::wk_Function, Function::fn_Contains },
+   { STRING_EXISTSINSIDE, WordKind::wk_Function, Function::fn_ExistsInside },
+   { STRING_STARTSWITH, WordKind::wk_Function, Function::fn_StartsWith },
+   { STRING_ENDSWITH, WordKind::wk_Function, Function::fn_EndsWith },
+   { STRING_FINDTEXT, WordKind::wk_Function, Function::fn_FindText },
+   { STRING_ISNAN, WordKind::wk_Function, Function::fn_IsNan },
+   { STRING_ISNEVER, WordKind::wk_Function, Function::fn_IsNever },
+   { STRING_ASKPYTHON, WordKind::wk_Function, Function::fn_AskPython },
+   { STRING_ASKPYTHON3, WordKind::wk_Function, Function::fn_AskPython3 },
+   // numeric functions:
+   { STRING_ABSOLUTE, WordKind::wk_Function, Function::fn_Absolute },
+   { STRING_CEIL, WordKind::wk_Function, Function::fn_Ceil },
+   { STRING_FLOOR, WordKind::wk_Function, Function::fn_Floor },
+   { STRING_ROUND, WordKind::wk_Function, Function::fn_Round },
+   { STRING_SIGN, WordKind::wk_Function, Function::fn_Sign },
+   { STRING_SQRT, WordKind::wk_Function, Function::fn_Sqrt },
+   { STRING_TRUNCATE, WordKind::wk_Function, Function::fn_Truncate },
+   { STRING_LENGTH, WordKind::wk_Function, Function::fn_Length },
+   { STRING_FROMBINARY, WordKind::wk_Function, Function::fn_FromBinary },
+   { STRING_FROMHEX, WordKind::wk_Function, Function::fn_FromHex },
+   { STRING_SIZE, WordKind::wk_Function, Function::fn_Size },
+   { STRING_NUMBER, WordKind::wk_Function, Function::fn_Number },
+   { STRING_COUNTINSIDE, WordKind::wk_Function, Function::fn_CountInside },
+   { STRING_COUNT, WordKind::wk_Function, Function::fn_Count },
+   { STRING_POWER, WordKind::wk_Function, Function::fn_Power },
+   { STRING_SHIFTMONTH, WordKind::wk_Function, Function::fn_ShiftMonth },
+   { STRING_SHIFTWEEKDAY, WordKind::wk_Function, Function::fn_ShiftWeekDay },
+   { STRING_RESEMBLANCE, WordKind::wk_Function, Function::fn_Resemblance },
+   // aggregate functions:
+   { STRING_AVERAGE, WordKind::wk_Function, Function::fn_Average },
+   { STRING_SUM, WordKind::wk_Function, Function::fn_Sum },
+   { STRING_MIN, WordKind::wk_Function, Function::fn_Min },
+   { STRING_MAX, WordKind::wk_Function, Function::fn_Max },
+   { STRING_MEDIAN, WordKind::wk_Function, Function::fn_Median },
+   // period functions:
+   { STRING_DURATION, WordKind::wk_Function, Function::fn_Duration },
+   // string functions:
+   { STRING_AFTER, WordKind::wk_Function, Function::fn_After },
+   { STRING_BEFORE, WordKind::wk_Function, Function::fn_Before },
+   { STRING_DIGITS, WordKind::wk_Function, Function::fn_Digits },
+   { STRING_LETTERS, WordKind::wk_Function, Function::fn_Letters },
+   { STRING_LOWER, WordKind::wk_Function, Function::fn_Lower },
+   { STRING_TRIM, WordKind::wk_Function, Function::fn_Trim },
+   { STRING_UPPER, WordKind::wk_Function, Function::fn_Upper },
+   { STRING_REVERSE, WordKind::wk_Function, Function::fn_Reverse },
+   { STRING_AFTERDIGITS, WordKind::wk_Function, Function::fn_AfterDigits },
+   { STRING_AFTERLETTERS, WordKind::wk_Function, Function::fn_AfterLetters },
+   { STRING_BEFOREDIGITS, WordKind::wk_Function, Function::fn_BeforeDigits },
+   { STRING_BEFORELETTERS, WordKind::wk_Function, Function::fn_BeforeLetters },
+   { STRING_CAPITALIZE, WordKind::wk_Function, Function::fn_Capitalize },
+   { STRING_PARENT, WordKind::wk_Function, Function::fn_Parent },
+   { STRING_RAW, WordKind::wk_Function, Function::fn_Raw },
+   { STRING_REVERSED, WordKind::wk_Function, Function::fn_Reversed },
+   { STRING_REPEAT, WordKind::wk_Function, Function::fn_Repeat },
+   { STRING_LEFT, WordKind::wk_Function, Function::fn_Left },
+   { STRING_RIGHT, WordKind::wk_Function, Function::fn_Right },
+   { STRING_FILL, WordKind::wk_Function, Function::fn_Fill },
+   { STRING_REPLACE, WordKind::wk_Function, Function::fn_Replace },
+   { STRING_SUBSTRING, WordKind::wk_Function, Function::fn_Substring },
+   { STRING_CONCATENATE, WordKind::wk_Function, Function::fn_Concatenate },
+   { STRING_PATH, WordKind::wk_Function, Function::fn_Path },
+   { STRING_STRING, WordKind::wk_Function, Function::fn_String },
+   { STRING_ROMAN, WordKind::wk_Function, Function::fn_Roman },
+   { STRING_BINARY, WordKind::wk_Function, Function::fn_Binary },
+   { STRING_HEX, WordKind::wk_Function, Function::fn_Hex },
+   { STRING_MONTHNAME, WordKind::wk_Function, Function::fn_MonthName },
+   { STRING_WEEKDAYNAME, WordKind::wk_Function, Function::fn_WeekDayName },
+   { STRING_JOIN, WordKind::wk_Function, Function::fn_Join },
+   // time functions:
+   { STRING_CHRISTMAS, WordKind::wk_Function, Function::fn_Christmas },
+   { STRING_EASTER, WordKind::wk_Function, Function::fn_Easter },
+   { STRING_NEWYEAR, WordKind::wk_Function, Function::fn_NewYear },
+   { STRING_DATE, WordKind::wk_Function, Function::fn_Date },
+   { STRING_TIME, WordKind::wk_Function, Function::fn_Time },
+   { STRING_CLOCK, WordKind::wk_Function, Function::fn_Clock },
+   // list functions:
+   { STRING_CHARACTERS, WordKind::wk_Function, Function::fn_Characters },
+   { STRING_WORDS, WordKind::wk_Function, Function::fn_Words },
+   { STRING_SPLIT, WordKind::wk_Function, Function::fn_Split },
+   // numeric list functions:
+   { STRING_NUMBERS, WordKind::wk_Function, Function::fn_Numbers },
+   // functions of several types:
+   { STRING_FIRST, WordKind::wk_Function, Function::fn_First },
+   { STRING_LAST, WordKind::wk_Function, Function::fn_Last },
+   { STRING_RANDOM, WordKind::wk_Function, Function::fn_Random }
+};
+
+p_constexpr p_size WORD_ENTRIES_COUNT = sizeof(WORD_ENTRIES) / sizeof(WordEntry);
+p_constexpr p_size WORD_TABLE_SIZE = 4096;
+p_constexpr p_size WORD_MAX_LENGTH = 24;
+p_constexpr uint8_t WORD_EMPTY_SLOT = 0xFF;
+p_constexpr uint32_t WORD_HASH_PRIME = 16777619U;
+p_constexpr uint32_t WORD_SEED_LIMIT = 100000;
+
+static_assert(WORD_ENTRIES_COUNT < WORD_EMPTY_SLOT, "every word entry needs its own index in a byte");
+
+
+// keyword_find() folds the case of a word in a buffer of WORD_MAX_LENGTH characters
+constexpr p_bool keyword_entriesFit()
+{
+   for (p_size i = 0; i < WORD_ENTRIES_COUNT; i++) {
+      if (WORD_ENTRIES[i].word.size() > WORD_MAX_LENGTH) {
+         return false;
+      }
+   }
+
+   return true;
+}
+
+static_assert(keyword_entriesFit(), "every word entry has to fit in WORD_MAX_LENGTH characters");
+
+
+// FNV-1a with a seed and a final mixing of bits, reduced to a table slot
+constexpr p_size keyword_hash(const p_char* text, const p_size length, const uint32_t seed)
+{
+   uint32_t hash = seed;
+
+   for (p_size i = 0; i < length; i++) {
+      hash ^= static_cast<uint32_t>(text[i]);
+      hash *= WORD_HASH_PRIME;
+   }
+
+   hash ^= hash >> 15;
+   hash *= 0x2C1B3C6DU;
+   hash ^= hash >> 12;
+   return static_cast<p_size>(hash & (WORD_TABLE_SIZE - 1));
+}
+
+// the first seed for which no two words share a slot
+constexpr uint32_t keyword_findSeed()
+{
+   for (uint32_t seed = 1; seed < WORD_SEED_LIMIT; seed++) {
+      p_bool used[WORD_TABLE_SIZE] = { };
+      p_bool collision = false;
+
+      for (p_size i = 0; i < WORD_ENTRIES_COUNT; i++) {
+         const p_size slot = keyword_hash(WORD_ENTRIES[i].word.data(), WORD_ENTRIES[i].word.size(), seed);
+         if (used[slot]) {
+            collision = true;
+            break;
+         }
+         used[slot] = true;
+      }
+
+      if (!collision) {
+         return seed;
+      }
+   }
+
+   return 0;
+}
+
+p_constexpr uint32_t WORD_SEED = keyword_findSeed();
+static_assert(WORD_SEED != 0, "no perfect hash seed was found for the keywords");
+
+
+struct WordTable
+{
+   uint8_t slots[WORD_TABLE_SIZE];
+};
+
+constexpr WordTable keyword_makeTable()
+{
+   WordTable table = { };
+
+   for (p_size i = 0; i < WORD_TABLE_SIZE; i++) {
+      table.slots[i] = WORD_EMPTY_SLOT;
+   }
+
+   for (p_size i = 0; i < WORD_ENTRIES_COUNT; i++) {
+      const p_size slot = keyword_hash(WORD_ENTRIES[i].word.data(), WORD_ENTRIES[i].word.size(), WORD_SEED);
+      table.slots[slot] = static_cast<uint8_t>(i);
+   }
+
+   return table;
+}
+
+p_constexpr WordTable WORD_TABLE = keyword_makeTable();
+
+
+WordId keyword_find(const p_char* text, const p_size length)
+{
+   if (length == 0 || length > WORD_MAX_LENGTH) {
+      return { WordKind::wk_None, 0 };
+   }
+
+   // all words in the table are lowercase ASCII
+   // so any other character means that this word is not there
+   p_char lowercase[WORD_MAX_LENGTH];
+
+   for (p_size i = 0; i < length; i++) {
+      const p_char ch = text[i];
+
+      if (ch >= CHAR_a && ch <= CHAR_z) {
+         lowercase[i] = ch;
+      }
+      else if (ch >= CHAR_A && ch <= CHAR_Z) {
+         lowercase[i] = ch - CHAR_A + CHAR_a;
+      }
+      else if (ch >= CHAR_0 && ch <= CHAR_9) {
+         lowercase[i] = ch;
+      }
+      else {
+         return { WordKind::wk_None, 0 };
+      }
+   }
+
+   const uint8_t index = WORD_TABLE.slots[keyword_hash(lowercase, length, WORD_SEED)];
+   if (index == WORD_EMPTY_SLOT) {
+      return { WordKind::wk_None, 0 };
+   }
+
+   const WordEntry& entry = WORD_ENTRIES[index];
+   if (entry.word != p_strv(lowercase, length)) {
+      return { WordKind::wk_None, 0 };
+   }
+
+   return { entry.kind, entry.value };
+}
 
 }
@@ -15,11 +15,14 @@
 #include "../include/perun2/lexer.hpp"
 #include "../include/perun2/exception.hpp"
 #include "../include/perun2/brackets.hpp"
+#include <algorithm>
 
 
 namespace perun2
 {
 
+p_constexpr p_char LEXER_ASCII_END = 128;
+
 // transform source code into a list of tokens
 // meanwhile, omit comments
 // both // singleline
@@ -140,7 +143,10 @@ std::vector<Token> tokenize(const p_str& code, Perun2Process& p2)
             }
 
             if (isAllowedInWord(c)) {
-               wlen++;
+               // consume the whole rest of the word at once
+               const p_size end = skipWord(code, i + 1);
+               wlen += end - i;
+               i = end - 1;
             }
             else {
                tokens.push_back(wordToken(code, wpos, wlen, line, p2));
@@ -171,18 +177,9 @@ std::vector<Token> tokenize(const p_str& code, Perun2Process& p2)
          }
          case Mode::m_ALiteral: {
             if (c == CHAR_APOSTROPHE) {
-               p_int asteriskId = -1;
-
-               for (p_size j = wpos; j < wpos + wlen; j++) {
-                  if (code[j] == CHAR_ASTERISK) {
-                     asteriskId = static_cast<p_int>(j);
-                     break;
-                  }
-               }
-
                const p_str origin = code.substr(wpos, wlen);
 
-               if (asteriskId == -1) {
+               if (origin.find(CHAR_ASTERISK) == p_str::npos) {
                   tokens.emplace_back(Token::t_Quotation, line, origin);
                }
                else {
@@ -194,10 +191,9 @@ std::vector<Token> tokenize(const p_str& code, Perun2Process& p2)
                mode = Mode::m_Nothing;
             }
             else {
-               wlen++;
-               if (isNewLine(c)) {
-                  line++;
-               }
+               const p_size end = skipUntil(code, i, CHAR_APOSTROPHE, line);
+               wlen += end - i;
+               i = end - 1;
             }
             break;
          }
@@ -210,10 +206,9 @@ std::vector<Token> tokenize(const p_str& code, Perun2Process& p2)
                mode = Mode::m_Nothing;
             }
             else {
-               wlen++;
-               if (isNewLine(c)) {
-                  line++;
-               }
+               const p_size end = skipUntil(code, i, CHAR_BACKTICK, line);
+               wlen += end - i;
+               i = end - 1;
             }
             break;
          }
@@ -222,16 +217,21 @@ std::vector<Token> tokenize(const p_str& code, Perun2Process& p2)
                line++;
                mode = Mode::m_Nothing;
             }
+            else {
+               i = skipUntil(code, i, CHAR_NEW_LINE, line) - 1;
+            }
             break;
          }
          case Mode::m_MultiComment: {
-            if (isNewLine(c)){
-               line++;
-            }
-            else if (prev == CHAR_ASTERISK && c == CHAR_SLASH) {
+            if (prev == CHAR_ASTERISK && c == CHAR_SLASH) {
                mode = Mode::m_Nothing;
                prevReset = true;
             }
+            else {
+               // stop at the next asterisk, so it becomes 'prev' for the next character
+               const p_size end = skipUntil(code, i, CHAR_ASTERISK, line);
+               i = end == code.length() ? end - 1 : end;
+            }
             break;
          }
       }
@@ -241,7 +241,7 @@ std::vector<Token> tokenize(const p_str& code, Perun2Process& p2)
          prev = CHAR_NULL;
       }
       else {
-         prev = c;
+         prev = code[i];
       }
    }
 
@@ -381,25 +381,25 @@ static Token wordToken(const p_str& code, const p_size start, const p_size lengt
 
    if (dots == 0) {
       const p_str origin = code.substr(start, length);
-      p_str word = origin;
-      str_toLower(word);
-      
-      auto fm = p2.keywordsData.MONTHS.find(word);
-      if (fm != p2.keywordsData.MONTHS.end()) {
-         return Token(p_num(fm->second), NumberMode::nm_Month, line, origin);
-      }
-
-      auto fw = p2.keywordsData.WEEKDAYS.find(word);
-      if (fw != p2.keywordsData.WEEKDAYS.end()) {
-         return Token(p_num(fw->second), NumberMode::nm_WeekDay, line, origin);
-      }
+      const WordId id = keyword_find(code.c_str() + start, length);
 
-      auto fk = p2.keywordsData.KEYWORDS.find(word);
-      if (fk == p2.keywordsData.KEYWORDS.end()) {
-         return Token(Token::t_Word, line, origin);
+      switch (id.kind) {
+         case WordKind::wk_Month: {
+            return Token(p_num(static_cast<p_nint>(id.value)), NumberMode::nm_Month, line, origin);
+         }
+         case WordKind::wk_WeekDay: {
+            return Token(p_num(static_cast<p_nint>(id.value)), NumberMode::nm_WeekDay, line, origin);
+         }
+         case WordKind::wk_Keyword: {
+            return Token(static_cast<Keyword>(id.value), line, origin);
+         }
+         case WordKind::wk_Function: {
+            return Token(static_cast<Function>(id.value), line, origin);
+         }
+         default: {
+            return Token(Token::t_Word, line, origin);
+         }
       }
-
-      return Token(fk->second, line, origin);
    }
 
    if (dots == 1) {
@@ -576,7 +576,37 @@ inline static p_bool isNewLine(const p_char ch)
 
 inline static p_bool isAllowedInWord(const p_char ch)
 {
-   return char_isAlpha(ch) || char_isDigit(ch) || ch == CHAR_DOT;
+   // most of the code is ASCII, so let us not ask the locale about it
+   if (ch < LEXER_ASCII_END) {
+      return (ch >= CHAR_a && ch <= CHAR_z)
+         || (ch >= CHAR_A && ch <= CHAR_Z)
+         || (ch >= CHAR_0 && ch <= CHAR_9)
+         || ch == CHAR_DOT;
+   }
+
+   return char_isAlpha(ch) || char_isDigit(ch);
+}
+
+// return the index of the first character after the word that continues from the start
+inline static p_size skipWord(const p_str& code, p_size start)
+{
+   const p_size length = code.length();
+
+   while (start < length && isAllowedInWord(code[start])) {
+      start++;
+   }
+
+   return start;
+}
+
+// return the index of the first occurrence of the character, or the length of the code
+// new lines skipped on the way are counted
+inline static p_size skipUntil(const p_str& code, const p_size start, const p_char ch, p_int& line)
+{
+   const p_size found = code.find(ch, start);
+   const p_size end = found == p_str::npos ? code.length() : found;
+   line += static_cast<p_int>(std::count(code.begin() + start, code.begin() + end, CHAR_NEW_LINE));
+   return end;
 }
 
 inline static p_bool isDoubleChar(const p_char ch)
@@ -95,7 +95,7 @@ void os_loadEmptyAttributes(FileContext& context)
       context.v_drive->value.clear();
    }
 
-   if (!attribute->has(ATTR_EXISTS)) {
+   if (!attribute->has(ATTR_TYPE_DEPENDENT)) {
       return;
    }
 
@@ -356,6 +356,20 @@ static p_str os_toWideString(const std::string& str)
    return p_str(buffer.begin(), buffer.end());
 }
 
+MediaAttributes os_ffmpegAttributes(const p_str& filePath, CacheUnit* unit)
+{
+   if (unit == nullptr) {
+      return os_ffmpegAttributes(filePath);
+   }
+
+   if (!unit->hasMedia) {
+      unit->media = os_ffmpegAttributes(filePath);
+      unit->hasMedia = true;
+   }
+
+   return unit->media;
+}
+
 MediaAttributes os_ffmpegAttributes(const p_str& filePath)
 {
    const std::string path = os_toUtf8(filePath);
@@ -39,6 +39,10 @@
 #include <cstdlib>
 #include <array>
 #include <optional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
 
 
 namespace perun2
@@ -153,13 +157,43 @@ void os_loadAttributes(FileContext& context)
       context.v_depth->value = os_depth(context.trimmed);
    }
 
-   if (!attribute->has(ATTR_EXISTS) || context.v_path->value.empty()) {
+   if (!attribute->has(ATTR_TYPE_DEPENDENT) || context.v_path->value.empty()) {
+      return;
+   }
+
+   if (!attribute->has(ATTR_EXISTS) && !os_hasExtension(context.trimmed)) {
+      // only extension or name is needed here
+      // and they are the same for a file and a directory without an extension
+      if (attribute->has(ATTR_EXTENSION)) {
+         context.v_extension->value.clear();
+      }
+
+      if (attribute->has(ATTR_NAME)) {
+         context.v_name->value = os_fullname(context.v_path->value);
+      }
+
       return;
    }
 
    // below are "real" attributes of files and directories
+   CacheUnit* const unit = context.perun2.cache.get(context.v_path->value);
    p_adata data;
-   const p_bool gotAttrs = GetFileAttributesExW(P_WINDOWS_PATH(context.v_path->value), GetFileExInfoStandard, &data);
+   p_bool gotAttrs;
+
+   if (unit != nullptr && unit->hasData) {
+      data = unit->data;
+      gotAttrs = unit->exists;
+   }
+   else {
+      gotAttrs = GetFileAttributesExW(P_WINDOWS_PATH(context.v_path->value), GetFileExInfoStandard, &data);
+
+      if (unit != nullptr) {
+         unit->hasData = true;
+         unit->exists = gotAttrs;
+         unit->data = data;
+      }
+   }
+
    const DWORD dwAttrib = data.dwFileAttributes;
    context.v_exists->value = gotAttrs && dwAttrib != INVALID_FILE_ATTRIBUTES;
 
@@ -220,7 +254,7 @@ void os_loadAttributes(FileContext& context)
       if (context.v_exists->value) {
          context.v_empty->value = context.v_isfile->value
             ? os_emptyFile(data)
-            : os_emptyDirectory(context.v_path->value);
+            : os_emptyDirectory(context.v_path->value, unit);
       }
       else {
          context.v_empty->value = false;
@@ -258,7 +292,7 @@ void os_loadAttributes(FileContext& context)
       if (context.v_exists->value) {
          context.v_size->value = context.v_isfile->value
             ? static_cast<p_nint>(os_bigInteger(data.nFileSizeLow, data.nFileSizeHigh))
-            : os_sizeDirectory(context.v_path->value, context.perun2);
+            : os_sizeDirectory(context.v_path->value, unit, context.perun2);
       }
       else {
          context.v_size->value = P_NaN;
@@ -276,7 +310,7 @@ void os_loadAttributes(FileContext& context)
    }
    
    if (attribute->has(ATTR_IMAGE_OR_VIDEO)) {
-      const MediaAttributes media = os_ffmpegAttributes(context.v_path->value);
+      const MediaAttributes media = os_ffmpegAttributes(context.v_path->value, unit);
       context.v_isimage->value = media.isImage;
       context.v_isvideo->value = media.isVideo;
       context.v_width->value = media.width;
@@ -319,7 +353,7 @@ void os_loadDataAttributes(FileContext& context, const p_fdata& data)
       context.v_depth->value = os_depth(context.trimmed);
    }
 
-   if (!attribute->has(ATTR_EXISTS)) {
+   if (!attribute->has(ATTR_TYPE_DEPENDENT)) {
       return;
    }
 
@@ -367,7 +401,7 @@ void os_loadDataAttributes(FileContext& context, const p_fdata& data)
    if (attribute->has(ATTR_EMPTY)) {
       context.v_empty->value = context.v_isfile->value
          ? (data.nFileSizeLow == 0 && data.nFileSizeHigh == 0)
-         : os_emptyDirectory(context.v_path->value);
+         : os_emptyDirectory(context.v_path->value, context.perun2.cache.get(context.v_path->value));
    }
 
    if (attribute->has(ATTR_ENCRYPTED)) {
@@ -400,7 +434,7 @@ void os_loadDataAttributes(FileContext& context, const p_fdata& data)
    if (attribute->has(ATTR_SIZE)) {
       context.v_size->value = context.v_isfile->value
          ? static_cast<p_nint>(os_bigInteger(data.nFileSizeLow, data.nFileSizeHigh))
-         : os_sizeDirectory(context.v_path->value, context.perun2);
+         : os_sizeDirectory(context.v_path->value, context.perun2.cache.get(context.v_path->value), context.perun2);
    }
    else if (attribute->has(ATTR_SIZE_FILE_ONLY)) {
       if (context.v_isfile->value) {
@@ -409,7 +443,7 @@ void os_loadDataAttributes(FileContext& context, const p_fdata& data)
    }
 
    if (attribute->has(ATTR_IMAGE_OR_VIDEO)) {
-      const MediaAttributes media = os_ffmpegAttributes(context.v_path->value);
+      const MediaAttributes media = os_ffmpegAttributes(context.v_path->value, context.perun2.cache.get(context.v_path->value));
       context.v_isimage->value = media.isImage;
       context.v_isvideo->value = media.isVideo;
       context.v_width->value = media.width;
@@ -418,6 +452,14 @@ void os_loadDataAttributes(FileContext& context, const p_fdata& data)
    }
 }
 
+void os_prefetchAttributes(const p_str& path, Cache& cache)
+{
+   const p_size generation = cache.getGeneration();
+   p_adata data;
+   const p_bool exists = GetFileAttributesExW(P_WINDOWS_PATH(path), GetFileExInfoStandard, &data);
+   cache.prefetch(path, generation, exists, data);
+}
+
 p_tim os_access(const p_str& path)
 {
    p_adata data;
@@ -551,6 +593,20 @@ p_bool os_emptyFile(const p_adata& data)
        && data.nFileSizeHigh == 0;
 }
 
+p_bool os_emptyDirectory(const p_str& path, CacheUnit* unit)
+{
+   if (unit == nullptr) {
+      return os_emptyDirectory(path);
+   }
+
+   if (!unit->hasEmpty) {
+      unit->empty = os_emptyDirectory(path);
+      unit->hasEmpty = true;
+   }
+
+   return unit->empty;
+}
+
 p_bool os_emptyDirectory(const p_str& path)
 {
    p_fdata data;
@@ -682,8 +738,33 @@ p_num os_sizeFile(const p_str& path)
    return static_cast<p_nint>(os_bigInteger(data.nFileSizeLow, data.nFileSizeHigh));
 }
 
+p_num os_sizeDirectory(const p_str& path, CacheUnit* unit, Perun2Process& p2)
+{
+   if (unit == nullptr) {
+      return os_sizeDirectory(path, p2);
+   }
+
+   if (!unit->hasSize) {
+      const p_num size = os_sizeDirectory(path, p2);
+
+      // an interrupted measurement is not a real size
+      if (p2.isNotRunning()) {
+         return size;
+      }
+
+      unit->size = size;
+      unit->hasSize = true;
+   }
+
+   return unit->size;
+}
+
 p_num os_sizeDirectory(const p_str& path, Perun2Process& p2)
 {
+   if (p2.sizeIndex.isEnabled()) {
+      return os_sizeDirectoryIndexed(path, p2);
+   }
+
    std::vector<p_entry> entries;
    p_list paths = { path };
    p_list bases;
@@ -702,7 +783,9 @@ p_num os_sizeDirectory(const p_str& path, Perun2Process& p2)
 
       if (goDeeper) {
          goDeeper = false;
-         if (os_directoryExists(paths.back())) {
+         // subdirectories come from the enumeration itself
+         // so only the root path has to be checked for existence
+         if (paths.size() > 1 || os_directoryExists(paths.back())) {
             const p_str newPath = str(paths.back(), gen::os::DEFAULT_PATTERN);
             entries.emplace_back();
             
@@ -784,6 +867,10 @@ p_bool os_sizeDirectorySatisfies(const p_str& path, IncrementalConstraint& const
       return state == Logic::True;
    }
 
+   if (p2.sizeIndex.isEnabled()) {
+      return os_sizeDirectorySatisfiesIndexed(path, constr, p2);
+   }
+
    std::vector<p_entry> entries;
    p_list paths = { path };
    p_list bases;
@@ -801,7 +888,9 @@ p_bool os_sizeDirectorySatisfies(const p_str& path, IncrementalConstraint& const
 
       if (goDeeper) {
          goDeeper = false;
-         if (os_directoryExists(paths.back())) {
+         // subdirectories come from the enumeration itself
+         // so only the root path has to be checked for existence
+         if (paths.size() > 1 || os_directoryExists(paths.back())) {
             const p_str newPath = str(paths.back(), gen::os::DEFAULT_PATTERN);
             entries.emplace_back();
             
@@ -885,6 +974,215 @@ p_bool os_sizeDirectorySatisfies(const p_str& path, IncrementalConstraint& const
    return constr.getFinalResult();
 }
 
+p_bool os_indexedDirectory(const p_str& path, SizeIndex& index, SizeIndexEntry& result)
+{
+   p_adata attributes;
+   if (!GetFileAttributesExW(P_WINDOWS_PATH(path), GetFileExInfoStandard, &attributes)
+      || !(attributes.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+   {
+      return false;
+   }
+
+   const p_nint creation = static_cast<p_nint>(os_bigInteger(
+      attributes.ftCreationTime.dwLowDateTime, attributes.ftCreationTime.dwHighDateTime));
+   const p_nint modification = static_cast<p_nint>(os_bigInteger(
+      attributes.ftLastWriteTime.dwLowDateTime, attributes.ftLastWriteTime.dwHighDateTime));
+
+   if (index.find(path, creation, modification, result)) {
+      return true;
+   }
+
+   result.creation = creation;
+   result.modification = modification;
+   result.filesSize = NINT_ZERO;
+   result.directories.clear();
+
+   p_entry handle;
+   p_fdata data;
+
+   if (!os_hasFirstFile(str(path, gen::os::DEFAULT_PATTERN), handle, data)) {
+      return true;
+   }
+
+   do {
+      const p_str v = data.cFileName;
+
+      if (!os_isBrowsePath(v)) {
+         if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+            result.directories.emplace_back(v);
+         }
+         else {
+            result.filesSize += static_cast<p_nint>(os_bigInteger(data.nFileSizeLow, data.nFileSizeHigh));
+         }
+      }
+   }
+   while (os_hasNextFile(handle, data));
+
+   // a partial enumeration is used only in this run and is not saved
+   const p_bool complete = GetLastError() == ERROR_NO_MORE_FILES;
+   os_closeEntry(handle);
+
+   if (complete) {
+      index.put(path, result);
+   }
+
+   return true;
+}
+
+void os_sizeDirectoriesParallel(p_list& paths, p_nint& totalSize, IncrementalConstraint* constr, Perun2Process& p2)
+{
+   std::mutex mutex;
+   std::condition_variable changed;
+   p_size active = 0;
+   p_bool stopped = false;
+
+   // the constraint is checked after every directory
+   // all threads stop as soon as the result is decided
+   auto work = [&]() {
+      SizeIndexEntry entry;
+      std::unique_lock<std::mutex> lock(mutex);
+
+      while (true) {
+         changed.wait(lock, [&]() { return stopped || !paths.empty() || active == 0; });
+
+         if (stopped || paths.empty()) {
+            changed.notify_all();
+            return;
+         }
+
+         const p_str current = std::move(paths.back());
+         paths.pop_back();
+         active++;
+
+         lock.unlock();
+         const p_bool exists = os_indexedDirectory(current, p2.sizeIndex, entry);
+         lock.lock();
+
+         active--;
+
+         if (p2.isNotRunning()) {
+            stopped = true;
+         }
+         else if (exists) {
+            if (constr == nullptr) {
+               totalSize += entry.filesSize;
+            }
+            else {
+               constr->increment(entry.filesSize);
+               if (constr->getState() != Logic::Unknown) {
+                  stopped = true;
+               }
+            }
+
+            for (const p_str& directory : entry.directories) {
+               paths.emplace_back(str(current, OS_SEPARATOR, directory));
+            }
+         }
+
+         changed.notify_all();
+      }
+   };
+
+   const p_size threadsCount = std::clamp<p_size>(std::thread::hardware_concurrency(),
+      OS_PARALLEL_SIZE_MIN_THREADS, OS_PARALLEL_SIZE_MAX_THREADS);
+   std::vector<std::thread> threads;
+   threads.reserve(threadsCount);
+
+   for (p_size i = 0; i < threadsCount; i++) {
+      threads.emplace_back(work);
+   }
+
+   for (std::thread& thread : threads) {
+      thread.join();
+   }
+}
+
+p_num os_sizeDirectoryIndexed(const p_str& path, Perun2Process& p2)
+{
+   p_list paths = { path };
+   p_nint totalSize = NINT_ZERO;
+   SizeIndexEntry entry;
+
+   while (!paths.empty()) {
+      if (p2.isNotRunning()) {
+         return P_NaN;
+      }
+
+      // small directories are measured at once
+      // threads are started only when enough subdirectories are waiting
+      if (paths.size() >= OS_PARALLEL_SIZE_MIN_DIRECTORIES) {
+         os_sizeDirectoriesParallel(paths, totalSize, nullptr, p2);
+         break;
+      }
+
+      const p_str current = std::move(paths.back());
+      paths.pop_back();
+
+      if (!os_indexedDirectory(current, p2.sizeIndex, entry)) {
+         continue;
+      }
+
+      totalSize += entry.filesSize;
+
+      for (const p_str& directory : entry.directories) {
+         paths.emplace_back(str(current, OS_SEPARATOR, directory));
+      }
+   }
+
+   if (p2.isNotRunning()) {
+      return P_NaN;
+   }
+
+   return totalSize;
+}
+
+// the constraint has already been loaded by os_sizeDirectorySatisfies
+p_bool os_sizeDirectorySatisfiesIndexed(const p_str& path, IncrementalConstraint& constr, Perun2Process& p2)
+{
+   p_list paths = { path };
+   p_nint totalSize = NINT_ZERO;
+   SizeIndexEntry entry;
+
+   while (!paths.empty()) {
+      if (p2.isNotRunning()) {
+         return false;
+      }
+
+      if (paths.size() >= OS_PARALLEL_SIZE_MIN_DIRECTORIES) {
+         os_sizeDirectoriesParallel(paths, totalSize, &constr, p2);
+         break;
+      }
+
+      const p_str current = std::move(paths.back());
+      paths.pop_back();
+
+      if (!os_indexedDirectory(current, p2.sizeIndex, entry)) {
+         continue;
+      }
+
+      constr.increment(entry.filesSize);
+      const Logic state = constr.getState();
+      if (state != Logic::Unknown) {
+         return state == Logic::True;
+      }
+
+      for (const p_str& directory : entry.directories) {
+         paths.emplace_back(str(current, OS_SEPARATOR, directory));
+      }
+   }
+
+   if (p2.isNotRunning()) {
+      return false;
+   }
+
+   const Logic state = constr.getState();
+   if (state != Logic::Unknown) {
+      return state == Logic::True;
+   }
+
+   return constr.getFinalResult();
+}
+
 p_bool os_exists(const p_str& path)
 {
    if (!os_isAbsolute(path)) {
@@ -915,20 +1213,27 @@ p_bool os_directoryExists(const p_str& path)
 }
 
 
+// directory entries are read in large batches (FIND_FIRST_EX_LARGE_FETCH)
+// and every entry already carries its attributes, size and times
+// so enumeration itself never needs a separate query per file
+// FindExInfoBasic skips the lookup of short 8.3 names, which are never used
 p_bool os_hasFirstFile(const p_str& path, p_entry& entry, p_fdata& output)
 {
-   entry = FindFirstFileEx(P_WINDOWS_PATH(path), FindExInfoBasic, &output, FindExSearchNameMatch, NULL, FIND_FIRST_EX_LARGE_FETCH); 
+   entry = FindFirstFileExW(P_WINDOWS_PATH(path), FindExInfoBasic, &output, 
+      FindExSearchNameMatch, NULL, FIND_FIRST_EX_LARGE_FETCH); 
    return entry != INVALID_HANDLE_VALUE;
 }
 
 p_bool os_hasNextFile(p_entry& entry, p_fdata& output)
 {
-   return FindNextFile(entry, &output);
+   return FindNextFileW(entry, &output);
 }
 
+// search handles have to be released with FindClose
+// CloseHandle fails on them and leaks the fetch buffer
 void os_closeEntry(p_entry& entry)
 {
-   CloseHandle(entry);
+   FindClose(entry);
 }
 
 //////
@@ -974,71 +1279,191 @@ p_bool os_dropFile(const p_str& path)
 
 p_bool os_dropDirectory(const p_str& path, Perun2Process& p2)
 {
-   p_entry hFind;
-   p_fdata FindFileData;
+   // every directory waits for its own enumeration, its subdirectories and its batches of files
+   // it is removed as soon as the last of them is done
+   struct DropDirectory
+   {
+      p_str path;
+      p_size parent;
+      p_size pending;
+   };
 
-   p_char DirPath[MAX_PATH];
-   p_char FileName[MAX_PATH];
+   enum DropTaskType
+   {
+      dtt_Enumerate = 0,
+      dtt_DeleteFiles,
+      dtt_RemoveDirectory
+   };
 
-   wcscpy(DirPath, const_cast<p_char*>(path.c_str()));
-   wcscat(DirPath, str(OS_SEPARATOR, CHAR_ASTERISK).c_str());
-   wcscpy(FileName, const_cast<p_char*>(path.c_str()));
-   wcscat(FileName, toStr(OS_SEPARATOR).c_str());
+   struct DropTask
+   {
+      DropTaskType type;
+      p_size directory;
+      p_list files;
+   };
 
-   if (!os_hasFirstFile(DirPath, hFind, FindFileData)) {
-      return false;
-   }
+   const p_size NO_PARENT = static_cast<p_size>(-1);
 
-   wcscpy(DirPath, FileName);
+   std::mutex mutex;
+   std::condition_variable changed;
+   std::vector<DropDirectory> directories = { { path, NO_PARENT, 1 } };
+   std::vector<DropTask> tasks = { { dtt_Enumerate, 0, p_list() } };
+   p_size active = 0;
+   p_bool failed = false;
+   p_bool removed = false;
 
-   p_bool bSearch = true;
-   while (bSearch) {
-      if (os_hasNextFile(hFind, FindFileData)) {
-         if (p2.isNotRunning()) {
-            os_closeEntry(hFind);
-            return false;
-         }
+   // called with the mutex locked
+   auto finish = [&](const p_size directory) {
+      if (--directories[directory].pending == 0) {
+         tasks.push_back({ dtt_RemoveDirectory, directory, p_list() });
+      }
+   };
 
-         const p_str v = FindFileData.cFileName;
+   auto work = [&]() {
+      std::unique_lock<std::mutex> lock(mutex);
 
-         if (os_isBrowsePath(v)) {
-            continue;
+      while (true) {
+         changed.wait(lock, [&]() { return failed || !tasks.empty() || active == 0; });
+
+         if (failed || tasks.empty()) {
+            changed.notify_all();
+            return;
          }
 
-         wcscat(FileName,FindFileData.cFileName);
-         if ((FindFileData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
-            if (!os_dropDirectory(FileName, p2)) {
-               os_closeEntry(hFind);
-               return false;
+         // the most recent tasks go first, so the tree is taken apart depth first
+         const DropTask task = std::move(tasks.back());
+         tasks.pop_back();
+         const p_str directoryPath = directories[task.directory].path;
+         active++;
+         lock.unlock();
+
+         p_bool success = true;
+         p_list subdirectories;
+         std::vector<p_list> batches;
+
+         switch (task.type) {
+            case dtt_Enumerate: {
+               p_entry handle;
+               p_fdata data;
+
+               if (!os_hasFirstFile(str(directoryPath, gen::os::DEFAULT_PATTERN), handle, data)) {
+                  success = false;
+                  break;
+               }
+
+               do {
+                  if (p2.isNotRunning()) {
+                     break;
+                  }
+
+                  const p_str v = data.cFileName;
+
+                  if (os_isBrowsePath(v)) {
+                     continue;
+                  }
+
+                  if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+                     subdirectories.emplace_back(str(directoryPath, OS_SEPARATOR, v));
+                  }
+                  else {
+                     if (batches.empty() || batches.back().size() == OS_PARALLEL_DROP_BATCH_SIZE) {
+                        batches.emplace_back();
+                        batches.back().reserve(OS_PARALLEL_DROP_BATCH_SIZE);
+                     }
+
+                     batches.back().emplace_back(str(directoryPath, OS_SEPARATOR, v));
+                  }
+               }
+               while (os_hasNextFile(handle, data));
+
+               success = GetLastError() == ERROR_NO_MORE_FILES;
+               os_closeEntry(handle);
+               break;
             }
+            case dtt_DeleteFiles: {
+               for (const p_str& file : task.files) {
+                  if (p2.isNotRunning()) {
+                     success = false;
+                     break;
+                  }
 
-            RemoveDirectoryW(FileName);
-            wcscpy(FileName,DirPath);
+                  // read-only files have to be unlocked first
+                  if (!DeleteFileW(P_WINDOWS_PATH(file))
+                     && !(os_unlock(file) && DeleteFileW(P_WINDOWS_PATH(file))))
+                  {
+                     success = false;
+                     break;
+                  }
+               }
+               break;
+            }
+            case dtt_RemoveDirectory: {
+               success = RemoveDirectoryW(P_WINDOWS_PATH(directoryPath)) != 0;
+               break;
+            }
          }
-         else {
-            if (FindFileData.dwFileAttributes & FILE_ATTRIBUTE_READONLY)
-               os_unlock(FileName);
 
-            if (!DeleteFileW(FileName)) {
-               os_closeEntry(hFind);
-               return false;
-            }
+         lock.lock();
+         active--;
 
-            wcscpy(FileName,DirPath);
+         if (!success || p2.isNotRunning()) {
+            failed = true;
          }
-      }
-      else {
-         if (GetLastError() == ERROR_NO_MORE_FILES)
-            bSearch = false;
          else {
-            os_closeEntry(hFind);
-            return false;
+            switch (task.type) {
+               case dtt_Enumerate: {
+                  for (p_str& subdirectory : subdirectories) {
+                     directories.push_back({ std::move(subdirectory), task.directory, 1 });
+                     directories[task.directory].pending++;
+                     tasks.push_back({ dtt_Enumerate, directories.size() - 1, p_list() });
+                  }
+
+                  for (p_list& batch : batches) {
+                     directories[task.directory].pending++;
+                     tasks.push_back({ dtt_DeleteFiles, task.directory, std::move(batch) });
+                  }
+
+                  finish(task.directory);
+                  break;
+               }
+               case dtt_DeleteFiles: {
+                  finish(task.directory);
+                  break;
+               }
+               case dtt_RemoveDirectory: {
+                  const p_size parent = directories[task.directory].parent;
+
+                  if (parent == NO_PARENT) {
+                     removed = true;
+                  }
+                  else {
+                     finish(parent);
+                  }
+                  break;
+               }
+            }
          }
+
+         changed.notify_all();
       }
+   };
+
+   // in the maximum performance mode, more threads join this one
+   const p_size threadsCount = (p2.flags & FLAG_MAX_PERFORMANCE) ? OS_PARALLEL_DROP_THREADS - 1 : 0;
+   std::vector<std::thread> threads;
+   threads.reserve(threadsCount);
+
+   for (p_size i = 0; i < threadsCount; i++) {
+      threads.emplace_back(work);
+   }
+
+   work();
+
+   for (std::thread& thread : threads) {
+      thread.join();
    }
-   os_closeEntry(hFind);
 
-   return RemoveDirectoryW(const_cast<p_char*>(P_WINDOWS_PATH(path))) != 0;
+   return removed;
 }
 
 p_bool os_hide(const p_str& path)
@@ -1222,7 +1647,7 @@ p_bool os_moveTo(const p_str& oldPath, const p_str& newPath)
 p_bool os_copyTo(const p_str& oldPath, const p_str& newPath, const p_bool isFile, Perun2Process& p2)
 {
    if (isFile) {
-      return os_copyToFile(oldPath, newPath);
+      return os_copyToFile(oldPath, newPath, p2);
    }
 
    if (os_isAncestor(oldPath, newPath)) {
@@ -1240,9 +1665,39 @@ p_bool os_copyTo(const p_str& oldPath, const p_str& newPath, const p_bool isFile
    return success;
 }
 
-p_bool os_copyToFile(const p_str& oldPath, const p_str& newPath)
+p_bool os_copyToFile(const p_str& oldPath, const p_str& newPath, Perun2Process& p2)
+{
+   // the size is not queried only for this decision
+   // if the attributes of the file have been loaded already, they are in the cache
+   // otherwise, the file is copied through the system cache as if it was small
+   const CacheUnit* unit = p2.cache.get(oldPath);
+   const p_nint size = (unit != nullptr && unit->hasData && unit->exists)
+      ? static_cast<p_nint>(os_bigInteger(unit->data.nFileSizeLow, unit->data.nFileSizeHigh))
+      : 0LL;
+
+   return os_copyToFile(oldPath, newPath, size, p2);
+}
+
+p_bool os_copyToFile(const p_str& oldPath, const p_str& newPath, const p_nint size, Perun2Process& p2)
 {
-   return CopyFileW(P_WINDOWS_PATH(oldPath), P_WINDOWS_PATH(newPath), true) != 0;
+   // data is copied by the system and never passes through this process
+   // where the volume supports it, the system clones blocks or offloads the copy to the server instead
+   DWORD flags = COPY_FILE_FAIL_IF_EXISTS;
+   if (size >= OS_UNBUFFERED_COPY_MIN_SIZE) {
+      flags |= COPY_FILE_NO_BUFFERING;
+   }
+
+   return CopyFileExW(P_WINDOWS_PATH(oldPath), P_WINDOWS_PATH(newPath), os_copyProgress, &p2, NULL, flags) != 0;
+}
+
+DWORD CALLBACK os_copyProgress(LARGE_INTEGER totalSize, LARGE_INTEGER totalTransferred, LARGE_INTEGER streamSize,
+   LARGE_INTEGER streamTransferred, DWORD streamNumber, DWORD reason, HANDLE source, HANDLE destination, LPVOID data)
+{
+   // a copy of a large file can be stopped in the middle
+   // then, the system deletes the partial copy by itself
+   return static_cast<Perun2Process*>(data)->isNotRunning()
+      ? PROGRESS_CANCEL
+      : PROGRESS_CONTINUE;
 }
 
 p_bool os_copyToDirectory(const p_str& oldPath, const p_str& newPath, Perun2Process& p2)
@@ -1251,71 +1706,157 @@ p_bool os_copyToDirectory(const p_str& oldPath, const p_str& newPath, Perun2Proc
       return false;
    }
 
-   const p_size length = oldPath.size() + 1;
+   struct FileCopy
+   {
+      p_str from;
+      p_str to;
+      p_nint size;
+   };
+
+   // in the maximum performance mode, files are copied by a pool of threads
+   // while this thread walks the tree and creates its directories
+   // otherwise, this thread copies every file by itself
+   const p_size threadsCount = (p2.flags & FLAG_MAX_PERFORMANCE) ? OS_PARALLEL_COPY_THREADS : 0;
+
+   std::mutex mutex;
+   std::condition_variable changed;
+   std::deque<FileCopy> copies;
+   p_nint bytesInFlight = NINT_ZERO;
+   p_bool walkFinished = false;
+   p_bool failed = false;
+
+   // a large file is not started while others are still being copied
+   // if together they would exceed the limit of bytes in flight
+   auto canStart = [&]() {
+      return !copies.empty()
+         && (bytesInFlight == NINT_ZERO || bytesInFlight + copies.front().size <= OS_PARALLEL_COPY_MAX_BYTES_IN_FLIGHT);
+   };
+
+   auto work = [&]() {
+      std::unique_lock<std::mutex> lock(mutex);
+
+      while (true) {
+         changed.wait(lock, [&]() { return failed || canStart() || (copies.empty() && walkFinished); });
+
+         if (failed || copies.empty()) {
+            return;
+         }
 
-   p_entry hFind;
-   p_fdata FindFileData;
+         const FileCopy copy = std::move(copies.front());
+         copies.pop_front();
+         bytesInFlight += copy.size;
+         changed.notify_all();
 
-   p_char DirPath[MAX_PATH];
-   p_char FileName[MAX_PATH];
+         lock.unlock();
+         const p_bool success = os_copyToFile(copy.from, copy.to, copy.size, p2);
+         lock.lock();
 
-   wcscpy(DirPath, const_cast<p_char*>(oldPath.c_str()));
-   wcscat(DirPath, str(OS_SEPARATOR, CHAR_ASTERISK).c_str());
-   wcscpy(FileName, const_cast<p_char*>(oldPath.c_str()));
-   wcscat(FileName, toStr(OS_SEPARATOR).c_str());
+         bytesInFlight -= copy.size;
 
-   if (!os_hasFirstFile(DirPath, hFind, FindFileData)) {
-      return false;
+         if (!success || p2.isNotRunning()) {
+            failed = true;
+         }
+
+         changed.notify_all();
+      }
+   };
+
+   std::vector<std::thread> threads;
+   threads.reserve(threadsCount);
+
+   for (p_size i = 0; i < threadsCount; i++) {
+      threads.emplace_back(work);
    }
 
-   wcscpy(DirPath, FileName);
+   auto addFile = [&](FileCopy&& copy) {
+      if (threadsCount == 0) {
+         return os_copyToFile(copy.from, copy.to, copy.size, p2);
+      }
+
+      std::unique_lock<std::mutex> lock(mutex);
+      changed.wait(lock, [&]() { return failed || copies.size() < OS_PARALLEL_COPY_QUEUE_CAPACITY; });
+
+      if (failed) {
+         return false;
+      }
+
+      copies.emplace_back(std::move(copy));
+      changed.notify_all();
+      return true;
+   };
+
+   std::vector<std::pair<p_str, p_str>> directories = { { oldPath, newPath } };
+   p_bool success = true;
+   p_fdata data;
+
+   while (success && !directories.empty()) {
+      const std::pair<p_str, p_str> directory = std::move(directories.back());
+      directories.pop_back();
+
+      p_entry handle;
+      if (!os_hasFirstFile(str(directory.first, gen::os::DEFAULT_PATTERN), handle, data)) {
+         success = false;
+         break;
+      }
 
-   p_bool bSearch = true;
-   while (bSearch) {
-      if (os_hasNextFile(hFind, FindFileData)) {
+      do {
          if (p2.isNotRunning()) {
-            os_closeEntry(hFind);
-            return false;
+            success = false;
+            break;
          }
 
-         const p_str v = FindFileData.cFileName;
+         const p_str v = data.cFileName;
 
          if (os_isBrowsePath(v)) {
             continue;
          }
 
-         wcscat(FileName, FindFileData.cFileName);
-         const p_str np = str(newPath, OS_SEPARATOR, p_str(FileName).substr(length));
+         const p_str from = str(directory.first, OS_SEPARATOR, v);
+         p_str to = str(directory.second, OS_SEPARATOR, v);
 
-         if ((FindFileData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
-            if (!os_copyToDirectory(FileName, np, p2)) {
-               os_closeEntry(hFind);
-               return false;
+         if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+            // the parent directory always exists here
+            if (!CreateDirectoryW(P_WINDOWS_PATH(to), NULL)) {
+               success = false;
+               break;
             }
 
-            wcscpy(FileName, DirPath);
+            directories.emplace_back(from, std::move(to));
          }
          else {
-            if (!os_copyToFile(FileName, np)) {
-               os_closeEntry(hFind);
-               return false;
-            }
+            const p_nint size = static_cast<p_nint>(os_bigInteger(data.nFileSizeLow, data.nFileSizeHigh));
 
-            wcscpy(FileName, DirPath);
+            if (!addFile({ from, std::move(to), size })) {
+               success = false;
+               break;
+            }
          }
       }
-      else {
-         if (GetLastError() == ERROR_NO_MORE_FILES)
-            bSearch = false;
-         else {
-            os_closeEntry(hFind);
-            return false;
-         }
+      while (os_hasNextFile(handle, data));
+
+      if (success && GetLastError() != ERROR_NO_MORE_FILES) {
+         success = false;
       }
+
+      os_closeEntry(handle);
    }
 
-   os_closeEntry(hFind);
-   return true;
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      walkFinished = true;
+
+      if (!success) {
+         failed = true;
+      }
+   }
+
+   changed.notify_all();
+
+   for (std::thread& thread : threads) {
+      thread.join();
+   }
+
+   return !failed;
 }
 
 p_bool os_copy(const p_set& paths)
@@ -2438,6 +2979,26 @@ p_str os_system32Path()
       : p_str();
 }
 
+p_str os_sizeIndexPath()
+{
+   p_char path[MAX_PATH];
+   if (!SHGetSpecialFolderPathW(0, path, CSIDL_LOCAL_APPDATA, FALSE)) {
+      return p_str();
+   }
+
+   const p_str directory = str(path, OS_SEPARATOR, STRING_DATA_DIRECTORY);
+   if (!os_directoryExists(directory) && !os_createDirectory(directory)) {
+      return p_str();
+   }
+
+   return str(directory, OS_SEPARATOR, STRING_SIZE_INDEX_FILE);
+}
+
+p_bool os_replaceFile(const p_str& oldPath, const p_str& newPath)
+{
+   return MoveFileExW(P_WINDOWS_PATH(oldPath), P_WINDOWS_PATH(newPath), MOVEFILE_REPLACE_EXISTING) != 0;
+}
+
 p_str os_downloadsPath()
 {
    HKEY hKey;
@@ -30,7 +30,8 @@ namespace perun2
 {
 
 Perun2Process::Perun2Process(const Arguments& args) : arguments(args), consoleSettings(), contexts(*this),
-   flags(args.getFlags()), logger(*this), postParseData(*this), terminator(*this), python3Processes(*this)
+   flags(args.getFlags()), logger(*this), postParseData(*this), terminator(*this), python3Processes(*this),
+   sizeIndex(args.getFlags()), cache(args.getFlags()), prefetcher(*this), walker(*this)
 {
    Perun2Process::tryInit();
 };
@@ -54,12 +55,30 @@ p_bool Perun2Process::run()
 
    this->executionType = ExecutionType::et_Run;
    this->exitCode = EXITCODE_OK;
+   this->cache.clear();
+   this->resetState();
 
-   const p_bool result = this->preParse() 
-       && this->parse() 
-       && this->postParse()
-       && this->runCommands();
+   if (! this->isPrepared()) {
+      this->prepared = false;
+      this->resetParsing();
+
+      if (! (this->preParse() && this->parse() && this->postParse())) {
+         this->sizeIndex.save();
+         return false;
+      }
+
+      this->prepared = true;
+   }
 
+   const p_bool result = this->runCommands();
+
+   // a run stopped by 'exit', an error or an interruption leaves its loops in the middle of an iteration
+   // so their commands cannot be reused by the next run
+   if (! result || this->state != State::s_Running) {
+      this->prepared = false;
+   }
+
+   this->sizeIndex.save();
    return result;
 };
 
@@ -72,6 +91,8 @@ p_bool Perun2Process::staticallyAnalyze()
 
    this->executionType = ExecutionType::et_StaticAnalysis;
    this->exitCode = EXITCODE_OK;
+   this->prepared = false;
+   this->resetParsing();
 
    if (this->preParse() 
        && this->parse() 
@@ -129,6 +150,8 @@ p_bool Perun2Process::preParse()
 
 p_bool Perun2Process::parse()
 {
+   const ArenaScope arenaScope(this->arena);
+
    try {
       const Tokens tks(this->tokens);
       if (!comm::parseCommands(this->commands, tks, *this)) {
@@ -174,6 +197,35 @@ p_bool Perun2Process::runCommands()
    return true;
 };
 
+// the commands parsed by the last run can be reused
+// unless they were parsed with a value of 'origin' or 'pendrives' that is outdated now
+p_bool Perun2Process::isPrepared()
+{
+   return this->prepared
+      && !this->postParseData.refresh();
+}
+
+// everything left by the last parsing is dropped before the next one
+void Perun2Process::resetParsing()
+{
+   this->commands.reset();
+   this->tokens.clear();
+   this->conditionContext.reset();
+   this->contexts.resetParsing();
+   this->postParseData.reset();
+
+   // no node of the old commands exists anymore
+   this->arena.reset();
+}
+
+// values changed by the commands of the previous run
+void Perun2Process::resetState()
+{
+   this->state = State::s_Running;
+   this->contexts.success->value = false;
+   this->contexts.setRootLocation(this->arguments.getLocation());
+}
+
 p_int Perun2Process::globalCount = 0;
 
 void Perun2Process::tryInit()
@@ -208,6 +260,12 @@ p_bool Perun2::run()
    return this->process.run();
 }
 
+p_bool Perun2::run(const p_str& location)
+{
+   this->arguments.setLocation(location);
+   return this->process.run();
+}
+
 p_bool Perun2::staticallyAnalyze()
 {
    return this->process.staticallyAnalyze();
@@ -35,32 +35,32 @@ void PostParseData::actualize(const Token& tk)
 
    if (tk.isWord(STRING_DESKTOP)) {
       if (this->isNotLoaded(CONST_CACHE_DESKTOP_PATH)) {
-         this->context.strings[STRING_DESKTOP]->value = os_desktopPath();
+         this->context.strings.get(STRING_DESKTOP)->value = os_desktopPath();
       }
    }
    else if (tk.isWord(STRING_PERUN2)) {
       if (this->isNotLoaded(CONST_CACHE_EXE_PATH)) {
-         this->context.strings[STRING_PERUN2]->value = os_executablePath();
+         this->context.strings.get(STRING_PERUN2)->value = os_executablePath();
       }
    }
    else if (tk.isWord(STRING_ALPHABET)) {
       if (this->isNotLoaded(CONST_CACHE_ALPHABET)) {
-         this->context.lists[STRING_ALPHABET]->value = this->getAlphabet();
+         this->context.lists.get(STRING_ALPHABET)->value = this->getAlphabet();
       }
    }
    else if (tk.isWord(STRING_ASCII)) {
       if (this->isNotLoaded(CONST_CACHE_ASCII)) {
-         this->context.lists[STRING_ASCII]->value = STRINGS_ASCII;
+         this->context.lists.get(STRING_ASCII)->value = STRINGS_ASCII;
       }
    }
    else if (tk.isWord(STRING_ORIGIN)) {
       if (this->isNotLoaded(CONST_CACHE_ORIGIN)) {
-         this->context.strings[STRING_ORIGIN]->value = this->perun2.arguments.getLocation();
+         this->context.strings.get(STRING_ORIGIN)->value = this->perun2.arguments.getLocation();
       }
    }
    else if (tk.isWord(STRING_ARGUMENTS)) {
       if (this->isNotLoaded(CONST_CACHE_ARGUMENTS)) {
-         this->context.lists[STRING_ARGUMENTS]->value = this->perun2.arguments.getArgs();
+         this->context.lists.get(STRING_ARGUMENTS)->value = this->perun2.arguments.getArgs();
       }
    }
    else if (tk.isWord(STRING_PENDRIVE)
@@ -69,14 +69,14 @@ void PostParseData::actualize(const Token& tk)
       if (this->isNotLoaded(CONST_CACHE_PENDRIVES)) {
          const p_list pendrives = os_pendrives();
          if (!pendrives.empty()) {
-            this->context.strings[STRING_PENDRIVE]->value = pendrives[0];
-            this->context.lists[STRING_PENDRIVES]->value = std::move(pendrives);
+            this->context.strings.get(STRING_PENDRIVE)->value = pendrives[0];
+            this->context.lists.get(STRING_PENDRIVES)->value = std::move(pendrives);
          }
       }
    }
    else if (tk.isWord(STRING_DOWNLOADS)) {
       if (this->isNotLoaded(CONST_CACHE_DOWNLOADS_PATH)) {
-         this->context.strings[STRING_DOWNLOADS]->value = os_downloadsPath();
+         this->context.strings.get(STRING_DOWNLOADS)->value = os_downloadsPath();
       }
    }
    else {
@@ -84,10 +84,53 @@ void PostParseData::actualize(const Token& tk)
    }
 }
 
+// all constants are loaded again by the next parsing
+void PostParseData::reset()
+{
+   this->value = CONST_CACHE_NULL;
+}
+
+// some constants can change between two runs of the same parsed script
+// reload them and return true if any of them has a new value
+p_bool PostParseData::refresh()
+{
+   p_bool changed = false;
+
+   if (this->isLoaded(CONST_CACHE_ORIGIN)) {
+      const p_str location = this->perun2.arguments.getLocation();
+      p_str& origin = this->context.strings.get(STRING_ORIGIN)->value;
+
+      if (origin != location) {
+         origin = location;
+         changed = true;
+      }
+   }
+
+   if (this->isLoaded(CONST_CACHE_PENDRIVES)) {
+      p_list pendrives = os_pendrives();
+      p_list& loaded = this->context.lists.get(STRING_PENDRIVES)->value;
+
+      if (loaded != pendrives) {
+         this->context.strings.get(STRING_PENDRIVE)->value = pendrives.empty()
+            ? p_str()
+            : pendrives[0];
+         loaded = std::move(pendrives);
+         changed = true;
+      }
+   }
+
+   return changed;
+}
+
+p_bool PostParseData::isLoaded(const p_cunit v) const
+{
+   return this->value & v;
+}
+
 void PostParseData::loadCmdPath()
 {
    if (this->isNotLoaded(CONST_CACHE_EXE_PATH)) {
-      this->context.strings[STRING_PERUN2]->value = os_executablePath();
+      this->context.strings.get(STRING_PERUN2)->value = os_executablePath();
    }
 
    if (this->isNotLoaded(CONST_CACHE_CMD_PROCESS)) {
@@ -111,19 +154,19 @@ Python3State PostParseData::getPython3State(p_str& cmdPath)
 p_str PostParseData::getPython3AskerPath()
 {
    if (this->isNotLoaded(CONST_CACHE_EXE_PATH)) {
-      this->context.strings[STRING_PERUN2]->value = os_executablePath();
+      this->context.strings.get(STRING_PERUN2)->value = os_executablePath();
    }
 
-   return str(os_parent(this->context.strings[STRING_PERUN2]->value), OS_SEPARATOR, comm::PYTHON_ASKER_ROOT_FILE);
+   return str(os_parent(this->context.strings.get(STRING_PERUN2)->value), OS_SEPARATOR, comm::PYTHON_ASKER_ROOT_FILE);
 }
 
 p_str PostParseData::getPython3AnalyzerPath()
 {
    if (this->isNotLoaded(CONST_CACHE_EXE_PATH)) {
-      this->context.strings[STRING_PERUN2]->value = os_executablePath();
+      this->context.strings.get(STRING_PERUN2)->value = os_executablePath();
    }
 
-   return str(os_parent(this->context.strings[STRING_PERUN2]->value), OS_SEPARATOR, comm::PYTHON_ANALYZER_ROOT_FILE);
+   return str(os_parent(this->context.strings.get(STRING_PERUN2)->value), OS_SEPARATOR, comm::PYTHON_ANALYZER_ROOT_FILE);
 }
 
 p_bool PostParseData::isNotLoaded(const p_cunit v)
@@ -138,7 +181,7 @@ p_bool PostParseData::isNotLoaded(const p_cunit v)
 
 p_str PostParseData::getCmdProcessStartingArgs() const
 {
-   return str(os_quoteEmbraced(this->context.strings[STRING_PERUN2]->value),
+   return str(os_quoteEmbraced(this->context.strings.get(STRING_PERUN2)->value),
       CHAR_SPACE, CHAR_MINUS, CHAR_FLAG_SILENT, CHAR_SPACE);
 }
 
@@ -23,7 +23,10 @@ namespace perun2::prog
 
    
 ProgramPatternComparer::ProgramPatternComparer(const p_str& pat)
-   : WildcardComparer(pat) { };
+   : WildcardComparer(pat) 
+{ 
+   this->compileBits(0);
+};
 
 
 p_size ProgramPatternComparer::getMinLength(const p_str& pat) const
@@ -94,4 +97,20 @@ Logic ProgramPatternComparer::checkState(const p_size n, const p_size m)
 }
 
 
+WildcardElement ProgramPatternComparer::getElement(const p_size index) const
+{
+   switch (this->pattern[index]) {
+      case CHAR_ASTERISK: {
+         return WildcardElement::we_AnyChars;
+      }
+      case CHAR_HASH: {
+         return WildcardElement::we_DigitsAndDots;
+      }
+      default: {
+         return WildcardElement::we_Literal;
+      }
+   }
+}
+
+
 }
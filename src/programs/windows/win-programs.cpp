@@ -48,7 +48,7 @@ p_bool WinProgram::saveValue(const p_str& value)
    }
 
    for (const p_str& name : this->names) {
-      this->context.strings[name]->value = value;
+      this->context.strings.get(name)->value = value;
    }
 
    return true;
@@ -0,0 +1,249 @@
+/*
+    This file is part of Perun2.
+    Perun2 is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    Perun2 is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with Perun2. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "../include/perun2/size-index.hpp"
+#include "../include/perun2/os/os.hpp"
+#include "../include/perun2/datatype/text/strings.hpp"
+#include <fstream>
+#include <algorithm>
+
+
+namespace perun2
+{
+
+// the file is read and written on the same machine
+// so numbers are stored in their native representation
+p_constexpr uint32_t SIZE_INDEX_SIGNATURE =     0x49533250;
+p_constexpr uint32_t SIZE_INDEX_VERSION =       2;
+p_constexpr uint32_t SIZE_INDEX_MAX_STRING =    32767;
+// every entry takes at least this many bytes: empty path, three numbers and no directories
+p_constexpr uint64_t SIZE_INDEX_MIN_ENTRY =     2 * sizeof(uint32_t) + 3 * sizeof(p_nint);
+
+template<typename T>
+static void sizeIndex_write(std::ofstream& stream, const T& value)
+{
+   stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+static void sizeIndex_writeString(std::ofstream& stream, const p_str& value)
+{
+   const uint32_t length = static_cast<uint32_t>(value.size());
+   sizeIndex_write(stream, length);
+   stream.write(reinterpret_cast<const char*>(value.data()), length * sizeof(p_char));
+}
+
+template<typename T>
+static p_bool sizeIndex_read(std::ifstream& stream, T& value)
+{
+   return static_cast<p_bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+// counts read from the file are checked against it before anything is allocated for them
+static uint64_t sizeIndex_remaining(std::ifstream& stream, const uint64_t fileSize)
+{
+   const uint64_t position = static_cast<uint64_t>(stream.tellg());
+   return position < fileSize
+      ? fileSize - position
+      : 0;
+}
+
+static p_bool sizeIndex_readString(std::ifstream& stream, p_str& value)
+{
+   uint32_t length;
+   if (!sizeIndex_read(stream, length) || length > SIZE_INDEX_MAX_STRING) {
+      return false;
+   }
+
+   value.resize(length);
+   return length == 0
+      || static_cast<p_bool>(stream.read(reinterpret_cast<char*>(&value[0]), length * sizeof(p_char)));
+}
+
+
+SizeIndex::SizeIndex(const p_flags flags)
+   : enabled(flags & FLAG_SIZE_INDEX) { };
+
+p_bool SizeIndex::isEnabled() const
+{
+   return this->enabled;
+}
+
+p_bool SizeIndex::find(const p_str& path, const p_nint creation, const p_nint modification, SizeIndexEntry& result)
+{
+   std::lock_guard<std::mutex> lock(this->mutex);
+
+   if (!this->loaded) {
+      this->load();
+   }
+
+   auto it = this->entries.find(str_lowercased(path));
+
+   if (it == this->entries.end()
+      || it->second.creation != creation
+      || it->second.modification != modification)
+   {
+      return false;
+   }
+
+   result = it->second;
+   return true;
+}
+
+void SizeIndex::put(const p_str& path, const SizeIndexEntry& entry)
+{
+   std::lock_guard<std::mutex> lock(this->mutex);
+   const p_str key = str_lowercased(path);
+   auto it = this->entries.find(key);
+
+   if (it != this->entries.end()) {
+      // subdirectories that disappeared take their whole indexed subtrees with them
+      for (const p_str& directory : it->second.directories) {
+         if (std::find(entry.directories.begin(), entry.directories.end(), directory) == entry.directories.end()) {
+            this->erase(str(key, OS_SEPARATOR, str_lowercased(directory)));
+         }
+      }
+   }
+
+   this->changed = true;
+   this->entries[key] = entry;
+}
+
+void SizeIndex::erase(const p_str& key)
+{
+   auto it = this->entries.find(key);
+   if (it == this->entries.end()) {
+      return;
+   }
+
+   const p_list directories = std::move(it->second.directories);
+   this->entries.erase(it);
+
+   for (const p_str& directory : directories) {
+      this->erase(str(key, OS_SEPARATOR, str_lowercased(directory)));
+   }
+}
+
+void SizeIndex::load()
+{
+   this->loaded = true;
+
+   const p_str path = os_sizeIndexPath();
+   if (path.empty()) {
+      return;
+   }
+
+   std::ifstream stream(path.c_str(), std::ios::binary | std::ios::ate);
+   if (!stream) {
+      return;
+   }
+
+   const uint64_t fileSize = static_cast<uint64_t>(stream.tellg());
+   stream.seekg(0, std::ios::beg);
+
+   uint32_t signature;
+   uint32_t version;
+   uint64_t count;
+
+   if (!sizeIndex_read(stream, signature) || signature != SIZE_INDEX_SIGNATURE
+      || !sizeIndex_read(stream, version) || version != SIZE_INDEX_VERSION
+      || !sizeIndex_read(stream, count)
+      || count > sizeIndex_remaining(stream, fileSize) / SIZE_INDEX_MIN_ENTRY)
+   {
+      return;
+   }
+
+   this->entries.reserve(static_cast<p_size>(count));
+
+   for (uint64_t i = 0; i < count; i++) {
+      p_str directoryPath;
+      SizeIndexEntry entry;
+      uint32_t directoriesCount;
+
+      if (!sizeIndex_readString(stream, directoryPath)
+         || !sizeIndex_read(stream, entry.creation)
+         || !sizeIndex_read(stream, entry.modification)
+         || !sizeIndex_read(stream, entry.filesSize)
+         || !sizeIndex_read(stream, directoriesCount)
+         || directoriesCount > sizeIndex_remaining(stream, fileSize) / sizeof(uint32_t))
+      {
+         // a damaged index is worth nothing
+         this->entries.clear();
+         return;
+      }
+
+      entry.directories.resize(directoriesCount);
+
+      for (p_str& directory : entry.directories) {
+         if (!sizeIndex_readString(stream, directory)) {
+            this->entries.clear();
+            return;
+         }
+      }
+
+      this->entries.emplace(std::move(directoryPath), std::move(entry));
+   }
+}
+
+void SizeIndex::save()
+{
+   std::lock_guard<std::mutex> lock(this->mutex);
+
+   if (!this->enabled || !this->changed) {
+      return;
+   }
+
+   const p_str path = os_sizeIndexPath();
+   if (path.empty()) {
+      return;
+   }
+
+   // write a temporary file first and then replace the old index with it
+   // so another Perun2 process never reads a half-written index
+   const p_str temporaryPath = str(path, STRING_TEMPORARY_FILE_SUFFIX);
+
+   {
+      std::ofstream stream(temporaryPath.c_str(), std::ios::binary | std::ios::trunc);
+      if (!stream) {
+         return;
+      }
+
+      sizeIndex_write(stream, SIZE_INDEX_SIGNATURE);
+      sizeIndex_write(stream, SIZE_INDEX_VERSION);
+      sizeIndex_write(stream, static_cast<uint64_t>(this->entries.size()));
+
+      for (const auto& pair : this->entries) {
+         const SizeIndexEntry& entry = pair.second;
+         sizeIndex_writeString(stream, pair.first);
+         sizeIndex_write(stream, entry.creation);
+         sizeIndex_write(stream, entry.modification);
+         sizeIndex_write(stream, entry.filesSize);
+         sizeIndex_write(stream, static_cast<uint32_t>(entry.directories.size()));
+
+         for (const p_str& directory : entry.directories) {
+            sizeIndex_writeString(stream, directory);
+         }
+      }
+
+      if (!stream) {
+         return;
+      }
+   }
+
+   if (os_replaceFile(temporaryPath, path)) {
+      this->changed = false;
+   }
+}
+
+}
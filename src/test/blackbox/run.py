@@ -21,11 +21,20 @@ os.environ['PYTHONIOENCODING'] = ENCODING
 def make_process(code):
   return subprocess.Popen(['perun2', '-d', 'res', '-c', code], stdin=subprocess.PIPE, stdout=subprocess.PIPE)
 
+def make_twice_process(code, secondLocation):
+  return subprocess.Popen(['perun2-twice', os.path.abspath('res'), os.path.abspath(secondLocation), code], stdin=subprocess.PIPE, stdout=subprocess.PIPE)
+
 def run_test_case(code, expectedOutput):
-  p = make_process(code)
+  check_output(make_process(code), code, expectedOutput)
+
+# the same code is run twice by one Perun2 object, the second time in another location
+def run_twice_test_case(code, expectedOutput, secondLocation = 'res', exitCode = EXIT_CODE_OK):
+  check_output(make_twice_process(code, secondLocation), code, expectedOutput, exitCode)
+
+def check_output(p, code, expectedOutput, exitCode = EXIT_CODE_OK):
   output = p.communicate()[0].decode(ENCODING)
   output = output.replace('\r\n', NEW_LINE).replace('\r', NEW_LINE)[:-1]
-  if p.returncode != EXIT_CODE_OK:
+  if p.returncode != exitCode:
     print("Test failed at running code: " + code)
     print("  Received exit code:" + NEW_LINE + str(p.returncode))
     print("  Received output:" + NEW_LINE + output)
@@ -3804,6 +3813,15 @@ if __name__ == '__main__':
   run_test_case("h = 8; 3 times { h += 5 } print h  ", "23")
   run_test_case("4.88 times { if index != 2 {print index * 10} }   ", lines("0", "10", "30"))
   run_test_case("u = 'abcde'; 3 times { print u; u = substring(u, 2) }   ", lines("abcde", "cde", "e"))
+  run_test_case("h = 8; 3 times { print h < 10; h += 5 }  ", lines(TRUE, FALSE, FALSE))
+  run_test_case("h = 8; 3 times { print h * 2 + 1; h += 5 }  ", lines("17", "27", "37"))
+  run_test_case("h = 'a'; 3 times { print h + 'b' + 'c'; h += 'x' }  ", lines("abc", "axbc", "axxbc"))
+  run_test_case("h = 8; 3 times { print -h; h -= 1 }  ", lines("-8", "-7", "-6"))
+  run_test_case("h = 2; 3 times { print h in 2, 3; h++ }  ", lines(TRUE, TRUE, FALSE))
+  run_test_case("h = 3 may 2020; 2 times { print h + 1 day; h += 1 year }  ", lines("4 May 2020", "4 May 2021"))
+  run_test_case("h = 3 may 2020; 2 times { print h.year; h += 1 year }  ", lines("2020", "2021"))
+  run_test_case("h = 1; while h * 2 < 8 { h; h++ }  ", lines("1", "2", "3"))
+  run_test_case("h = 'a'; while length(h + 'b') < 4 { h; h += 'a' }  ", lines("a", "aa"))
   run_test_case("k = 'abcde'; k[2] = 'g'; k  ", "abgde")
   run_test_case("k = 'abcde'; k[2] = ''; k  ", "abde")
   run_test_case("k = 'abcde'; k[2] = 89; k  ", "ab89de")
@@ -4953,6 +4971,62 @@ if __name__ == '__main__':
   run_test_case("print 'Ahghjgh' REGEXP '^[ab]' ", FALSE)
   run_test_case("print 'ahghjgh' REGEXP '^[ab]' ", TRUE)
   run_test_case("print 'ahghjgh' not REGEXP '^[ab]' ", FALSE)
+  run_test_case("print 'aa' regexp '^a{2}$' ", TRUE)
+  run_test_case("print 'aaa' regexp '^a{2}$' ", FALSE)
+  run_test_case("print 'aaa' regexp '^a{2,}$' ", TRUE)
+  run_test_case("print 'a' regexp '^a{2,}$' ", FALSE)
+  run_test_case("print 'aaa' regexp '^a{2,3}$' ", TRUE)
+  run_test_case("print 'aaaa' regexp '^a{2,3}$' ", FALSE)
+  run_test_case("print 'ac' regexp '^ab{0}c$' ", TRUE)
+  run_test_case("print 'abab' regexp '^(ab){2}$' ", TRUE)
+  run_test_case("print 'aaa' regexp '^a+?$' ", TRUE)
+  run_test_case("print 'b' regexp '^a??b$' ", TRUE)
+  run_test_case("print 'aab' regexp '^a{1,2}?b$' ", TRUE)
+  run_test_case("print 'aaab' regexp '^a{1,2}?b$' ", FALSE)
+  run_test_case("print 'foo bar' regexp '\\bbar' ", TRUE)
+  run_test_case("print 'foobar' regexp '\\bbar' ", FALSE)
+  run_test_case("print 'foobar' regexp '\\Bbar' ", TRUE)
+  run_test_case("print 'foo bar' regexp '\\Bbar' ", FALSE)
+  run_test_case("print 'a_b' regexp 'a\\b' ", FALSE)
+  run_test_case("print 'a-b' regexp 'a\\b' ", TRUE)
+  run_test_case("print 'ab12' regexp '^\\w+\\d$' ", TRUE)
+  run_test_case("print 'ab' regexp '\\d' ", FALSE)
+  run_test_case("print '12' regexp '\\D' ", FALSE)
+  run_test_case("print 'a b' regexp 'a\\sb' ", TRUE)
+  run_test_case("print 'a-b' regexp 'a\\sb' ", FALSE)
+  run_test_case("print 'a-b' regexp 'a\\Wb' ", TRUE)
+  run_test_case("print 'a_b' regexp 'a\\Wb' ", FALSE)
+  run_test_case("print 'x7' regexp '^x[\\d]$' ", TRUE)
+  run_test_case("print 'a b' regexp 'a[\\s_]b' ", TRUE)
+  run_test_case("print 'a_b' regexp 'a[\\s_]b' ", TRUE)
+  run_test_case("print 'a-b' regexp 'a[\\s_]b' ", FALSE)
+  run_test_case("print 'a-b' regexp 'a[^\\w]b' ", TRUE)
+  run_test_case("print 'a1b' regexp 'a[^\\w]b' ", FALSE)
+  run_test_case("print 'a1b' regexp 'a[\\D]b' ", FALSE)
+  run_test_case("print 'm' regexp '^[a-z]$' ", TRUE)
+  run_test_case("print 'M' regexp '^[a-z]$' ", FALSE)
+  run_test_case("print 'M' regexp '^[^a-z]$' ", TRUE)
+  run_test_case("print '5' regexp '^[0-46-9]$' ", FALSE)
+  run_test_case("print '7' regexp '^[0-46-9]$' ", TRUE)
+  run_test_case("print 'q' regexp '^[^a-fq]$' ", FALSE)
+  run_test_case("print 'a b' regexp 'a.b' ", TRUE)
+  run_test_case("print 'a\nb' regexp 'a.b' ", FALSE)
+  run_test_case("print 'a\rb' regexp 'a.b' ", FALSE)
+  run_test_case("print 'a\nb' regexp 'a[^x]b' ", TRUE)
+  run_test_case("print 'a\nb' regexp 'a\\nb' ", TRUE)
+  run_test_case("print 'a\rb' regexp 'a\\rb' ", TRUE)
+  run_test_case("print 'abab' regexp '^(ab)\\1$' ", TRUE)
+  run_test_case("print 'abba' regexp '^(ab)\\1$' ", FALSE)
+  run_test_case("print 'foobar' regexp 'foo(?=bar)' ", TRUE)
+  run_test_case("print 'foobaz' regexp 'foo(?=bar)' ", FALSE)
+  run_test_case("print 'foobaz' regexp 'foo(?!bar)' ", TRUE)
+  run_test_case("print 'aa' regexp '^a{1,2000}$' ", TRUE)
+  run_test_case("p = 'o+'; print 'foo' regexp p ", TRUE)
+  run_test_case("p = '^(ab)\\1$'; print 'abab' regexp p ", TRUE)
+  expect_syntax_error("print 'abc' regexp '(a' ")
+  expect_syntax_error("print 'abc' regexp '[a' ")
+  expect_syntax_error("print 'abc' regexp 'a{2,1}' ")
+  expect_runtime_error("p = '(a'; print 'abc' regexp p ")
 
 
 
@@ -5337,6 +5411,8 @@ if __name__ == '__main__':
   lines("1", "0", "1", "doc", "a.pdf", "a.pdf.doc", "1")))
   (run_test_case("inside 'ccc' { 'g.png/a.pdf.do' { isFile, isDirectory, exists, extension, name, fullname, depth  } } ", 
   lines("1", "0", "0", "do", "a.pdf", "a.pdf.do", "1")))
+  run_test_case("inside 'ccc' { 'g', 'g2', 'g.png', 'g2.png' { name + ':' + extension } } ", lines("g:", "g2:", "g.png:", "g2:png"))
+  run_test_case("inside 'ccc' { 'g', 'g2', 'g.png', 'g2.png' where extension = 'png' } ", "g2.png")
   run_test_case("inside 'ccc' { createFile 'z1.txt'; 'z1.txt' { creation.year != -1; creation.second != -1 } }", lines("Create file 'z1.txt'", TRUE, TRUE))
   run_test_case("inside 'ccc' { createFile 'z2.txt'; 'z2.txt' { a = modification.date; a.year != -1; a.day != -1 } }", lines("Create file 'z2.txt'", TRUE, TRUE))
   run_test_case("inside 'numbers' { recursiveDirectories order by depth desc { name } }", lines("6", "5", "4", "3", "2", "1"))
@@ -6670,6 +6746,25 @@ if __name__ == '__main__':
   expect_syntax_error("print 'a' not in resembles 'b' ")
   expect_syntax_error("print 'a' not like resembles 'b' ")
 
+  run_twice_test_case("print 'hello'", lines("hello", "hello"))
+  run_twice_test_case("a = 1; while a < 3 { a; a++; }  ", lines("1", "2", "1", "2"))
+  run_twice_test_case("h = 8; 3 times { print h < 10; h += 5 }  ", lines(TRUE, FALSE, FALSE, TRUE, FALSE, FALSE))
+  run_twice_test_case("h = 8; print h; h += 5 ", lines("8", "8"))
+  run_twice_test_case("s = 'a'; 2 times { s += 'b' } print s ", lines("abb", "abb"))
+  run_twice_test_case("print origin = location", lines(TRUE, TRUE))
+  run_twice_test_case("print origin = location", lines(TRUE, TRUE), path('res', 'numbers'))
+  run_twice_test_case("x = origin; print x = location", lines(TRUE, TRUE), path('res', 'numbers'))
+  run_twice_test_case("a = 1; while a < 3 { a; a++; } print origin = location", lines("1", "2", TRUE, "1", "2", TRUE), path('res', 'numbers'))
+  run_twice_test_case("print location = origin + 'x' ", lines(FALSE, FALSE), path('res', 'numbers'))
+  run_twice_test_case("inside 'numbers' { files { print name; exit } }", lines("1.txt", "1.txt"))
+  run_twice_test_case("inside 'numbers' { ** where name = '5.txt' { print name; exit } }", lines("5.txt", "5.txt"))
+  run_twice_test_case("inside 'numbers' { files { print name; break } }", lines("1.txt", "1.txt"))
+  run_twice_test_case("inside 'numbers' { ** where name = '5.txt' { print name; break } }", lines("5.txt", "5.txt"))
+  run_twice_test_case("p = '(a'; inside 'numbers' { files { print name; print name regexp p } }", 
+    lines("1.txt", "1.txt"), exitCode = EXIT_CODE_RUNTIME_ERROR)
+  run_twice_test_case("p = '(a'; inside 'numbers' { ** where name = '5.txt' { print name; print name regexp p } }", 
+    lines("5.txt", "5.txt"), exitCode = EXIT_CODE_RUNTIME_ERROR)
+
   print ("BLACK-BOX TESTS END")
   print ("All tests have passed successfully if there is no error message above.")
   input("Press Enter to continue...")
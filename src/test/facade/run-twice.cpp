@@ -0,0 +1,47 @@
+/*
+    This file is part of Perun2.
+    Perun2 is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    Perun2 is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with Perun2. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../../include/perun2/perun2.hpp"
+#include "../../../include/perun2/cmd.hpp"
+
+
+// used by the black-box tests
+// run one script twice with the same facade object: first in one location, then in another
+// arguments: first location, second location, code
+int main(void)
+{
+   int argc;
+   LPWSTR* argv = CommandLineToArgvW(GetCommandLineW(), &argc);
+
+   if (argv == NULL) {
+      perun2::cmd::error::argumentsNotAccessed();
+      return perun2::EXITCODE_CLI_ERROR;
+   }
+
+   if (argc != 4) {
+      LocalFree(argv);
+      return perun2::EXITCODE_CLI_ERROR;
+   }
+
+   const perun2::p_str secondLocation = argv[2];
+   perun2::Perun2 instance(argv[1], argv[3]);
+
+   // the second run happens also after a failed first one
+   // the exit code comes from the second run
+   instance.run();
+   instance.run(secondLocation);
+
+   LocalFree(argv);
+   return instance.getExitCode();
+}
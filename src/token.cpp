@@ -34,6 +34,9 @@ TokenValue::TokenValue(const p_num& n, const NumberMode nm)
 TokenValue::TokenValue(const Keyword k)
    : keyword(k) { };
 
+TokenValue::TokenValue(const Function f)
+   : function(f) { };
+
 
 
 Token::Token(const p_char v, const p_int li, const p_str& o)
@@ -46,11 +49,15 @@ Token::Token(const p_num& v, const NumberMode nm, const p_int li, const p_str& o
    : type(t_Number), value(v, nm), line(li), origin(o), origin2(), lowercase(str_lowercased(o)) { };
 
 Token::Token(const Type type, const p_int li, const p_str& o)
-   : type(type), value(), line(li), origin(o), origin2(), lowercase(str_lowercased(o)) { };
+   : type(type), value(type == t_Word ? TokenValue(Function::fn_null) : TokenValue()), 
+     line(li), origin(o), origin2(), lowercase(str_lowercased(o)) { };
 
 Token::Token(const Keyword v, const p_int li, const p_str& o)
    : type(t_Keyword), value(v), line(li), origin(o), origin2(), lowercase(str_lowercased(o)) { };
 
+Token::Token(const Function v, const p_int li, const p_str& o)
+   : type(t_Word), value(v), line(li), origin(o), origin2(), lowercase(str_lowercased(o)) { };
+
 Token::Token(const p_int li, const p_str& o, const p_str& o2)
    : type(t_TwoWords), value(), line(li), origin(o), origin2(o2), 
      lowercase(str_lowercased(o)), lowercase2(str_lowercased(o2)) { };
@@ -67,6 +74,11 @@ p_bool Token::isKeyword(const Keyword kw) const
    return type == t_Keyword && value.keyword == kw;
 }
 
+p_bool Token::isFunction(const Function fn) const
+{
+   return type == t_Word && value.function == fn;
+}
+
 p_bool Token::isWord(const p_strv word) const
 {
    return type == t_Word && word == lowercase;